@@ -0,0 +1,14 @@
+// benchmark/BenchmarkMain.cpp
+#include "Log.h"
+#include <benchmark/benchmark.h>
+
+int main(int argc, char** argv) {
+    Log::setLevel(Log::AVERTISSEMENT); // Les messages d'annulation ou de chargement fausseraient les mesures
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,54 @@
+// benchmark/Boards.h
+#ifndef BOARDS_H
+#define BOARDS_H
+
+#include "Grid.h"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <cstdint>
+
+/**
+ * @brief Remplit une grille carrée de cellules vivantes tirées au hasard (graine fixe).
+ *
+ * @param grid Grille à remplir (ses dimensions sont conservées).
+ * @param densityPercent Proportion de cellules vivantes, en pour cent.
+ * @param rule Règle de la grille.
+ */
+inline void fillRandom(Grid& grid, int densityPercent, const Rule& rule = Rule()) {
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> percent(0, 99);
+    Pattern pattern;
+    pattern.alive = BitPlane(grid.getRows(), grid.getCols());
+    pattern.rule = rule;
+    for (int i = 0; i < grid.getRows(); ++i) {
+        for (int j = 0; j < grid.getCols(); ++j) {
+            if (percent(random) < densityPercent) {
+                pattern.alive.set(i, j);
+            }
+        }
+    }
+    grid.loadPattern(pattern);
+}
+
+/**
+ * @brief Ajoute le débit en cellules traitées par seconde.
+ *
+ * @param state État de la mesure.
+ * @param cells Nombre de cellules traitées par itération.
+ */
+inline void reportCells(benchmark::State& state, std::int64_t cells) {
+    state.counters["cells/s"] = benchmark::Counter(static_cast<double>(cells) * state.iterations(), benchmark::Counter::kIsRate);
+}
+
+/**
+ * @brief Ajoute le débit en cellules par seconde et la durée d'une génération en nanosecondes.
+ *
+ * @param state État de la mesure (une génération par itération).
+ * @param cells Nombre de cellules de la grille.
+ */
+inline void reportGenerations(benchmark::State& state, std::int64_t cells) {
+    reportCells(state, cells);
+    state.counters["ns/gen"] = benchmark::Counter(state.iterations() / 1e9, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+#endif // BOARDS_H
@@ -0,0 +1,108 @@
+// benchmark/GridBenchmark.cpp
+#include "Boards.h"
+#include <string>
+
+namespace {
+
+const char* const RULES[] = { "B3/S23", "B36/S23", "B3678/S34678", "B2/S" }; // Conway, HighLife, Day & Night, Seeds
+
+// Côté de la grille, densité en %, topologie torique, threads
+void boardSweeps(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgNames({ "cote", "densite", "torique", "threads" });
+    for (int side : { 25, 64, 256, 1024, 4096, 16384 }) {
+        benchmark->Args({ side, 35, 0, 1 });
+    }
+    for (int density : { 5, 20, 50, 80 }) {
+        benchmark->Args({ 1024, density, 0, 1 });
+    }
+    benchmark->Args({ 1024, 35, 1, 1 });
+    benchmark->Args({ 4096, 35, 1, 1 });
+    for (int threads : { 2, 4, 8 }) {
+        benchmark->Args({ 4096, 35, 0, threads });
+        benchmark->Args({ 16384, 35, 0, threads });
+    }
+}
+
+// Grille de la mesure, d'après les arguments de boardSweeps
+void prepare(const benchmark::State& state, Grid& grid, const Rule& rule = Rule()) {
+    grid.setToric(state.range(2) != 0);
+    grid.setThreads(static_cast<unsigned>(state.range(3)));
+    grid.setHistoryLimit(1); // Conserve la détection d'état stable sans accumuler l'historique
+    fillRandom(grid, static_cast<int>(state.range(1)), rule);
+}
+
+// Une génération par itération
+void BM_Update(benchmark::State& state) {
+    int side = static_cast<int>(state.range(0));
+    Grid grid(side, side);
+    prepare(state, grid);
+    for (auto _ : state) {
+        grid.update();
+    }
+    reportGenerations(state, static_cast<std::int64_t>(side) * side);
+}
+
+// Une génération par itération, pour chaque règle (grille de 1024 x 1024)
+void BM_UpdateRule(benchmark::State& state) {
+    Rule rule = Rule::parse(RULES[state.range(0)]);
+    state.SetLabel(RULES[state.range(0)]);
+    Grid grid(1024, 1024);
+    grid.setHistoryLimit(1);
+    fillRandom(grid, 35, rule);
+    for (auto _ : state) {
+        grid.update();
+    }
+    reportGenerations(state, 1024 * 1024);
+}
+
+// Détection d'état stable, pire cas : grille stable (blocs 2 x 2) dont toutes les tuiles sont marquées modifiées
+void BM_HasStableState(benchmark::State& state) {
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    int side = static_cast<int>(state.range(0));
+    Grid grid(side, side);
+    grid.setHistoryLimit(1);
+    Pattern pattern;
+    pattern.alive = BitPlane(side, side);
+    for (int i = 0; i < side; ++i) {
+        for (int j = 0; j < side; ++j) {
+            if (i % 4 < 2 && j % 4 < 2) {
+                pattern.alive.set(i, j);
+            }
+        }
+    }
+    grid.loadPattern(pattern);
+    grid.update();
+    for (int i = 0; i < side; i += tileSize) {
+        for (int j = 0; j < side; j += tileSize) {
+            grid.toggleCell(j, i, 1, VIVANT); // Cellule déjà vivante : tuile marquée, contenu identique
+        }
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(grid.hasStableState());
+    }
+    if (!grid.hasStableState()) {
+        state.SkipWithError("La grille de blocs devrait être stable");
+    }
+    reportCells(state, static_cast<std::int64_t>(side) * side);
+}
+
+// Annulation d'une génération (la génération elle-même n'est pas mesurée)
+void BM_Undo(benchmark::State& state) {
+    int side = static_cast<int>(state.range(0));
+    Grid grid(side, side);
+    prepare(state, grid);
+    for (auto _ : state) {
+        state.PauseTiming();
+        grid.update();
+        state.ResumeTiming();
+        grid.undo();
+    }
+    reportCells(state, static_cast<std::int64_t>(side) * side);
+}
+
+} // namespace
+
+BENCHMARK(BM_Update)->Apply(boardSweeps)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_UpdateRule)->DenseRange(0, static_cast<int>(sizeof(RULES) / sizeof(RULES[0])) - 1)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_HasStableState)->ArgName("cote")->RangeMultiplier(4)->Range(256, 16384)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Undo)->Apply(boardSweeps)->UseRealTime()->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,86 @@
+// benchmark/LoadBenchmark.cpp
+#include "Boards.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace {
+
+// Fichier de grille écrit pour la mesure, supprimé à la fin
+class BoardFile {
+public:
+    BoardFile(const std::string& extension, int side) : name("benchmark_" + std::to_string(side) + extension) {}
+    ~BoardFile() { std::remove(name.c_str()); }
+
+    const std::string& getName() const { return name; }
+
+    long long size() const {
+        std::ifstream file(name, std::ios::binary | std::ios::ate);
+        return static_cast<long long>(file.tellg());
+    }
+
+private:
+    std::string name;
+};
+
+// Écrit la grille au format texte (« 1 », « 0 » séparés par des espaces)
+void writeText(const Grid& grid, const std::string& filename) {
+    std::string line;
+    std::ofstream file(filename, std::ios::binary);
+    for (int i = 0; i < grid.getRows(); ++i) {
+        line.clear();
+        for (int j = 0; j < grid.getCols(); ++j) {
+            line += grid.getCellState(i, j) == VIVANT ? "1 " : "0 ";
+        }
+        line += '\n';
+        file << line;
+    }
+}
+
+// Lecture d'un fichier texte ; les dimensions sont déduites du fichier
+void BM_LoadText(benchmark::State& state) {
+    int side = static_cast<int>(state.range(0));
+    Grid grid(side, side);
+    fillRandom(grid, 35);
+    BoardFile file(".txt", side);
+    writeText(grid, file.getName());
+    for (auto _ : state) {
+        grid.loadFromInput(file.getName());
+    }
+    state.SetBytesProcessed(file.size() * state.iterations());
+    reportCells(state, static_cast<std::int64_t>(side) * side);
+}
+
+// Lecture d'un fichier RLE
+void BM_LoadRLE(benchmark::State& state) {
+    int side = static_cast<int>(state.range(0));
+    Grid grid(side, side);
+    fillRandom(grid, 35);
+    BoardFile file(".rle", side);
+    grid.saveRLE(file.getName());
+    for (auto _ : state) {
+        grid.initializeFromRLE(file.getName());
+    }
+    state.SetBytesProcessed(file.size() * state.iterations());
+    reportCells(state, static_cast<std::int64_t>(side) * side);
+}
+
+// Lecture d'un instantané binaire compressé
+void BM_LoadBinary(benchmark::State& state) {
+    int side = static_cast<int>(state.range(0));
+    Grid grid(side, side);
+    fillRandom(grid, 35);
+    BoardFile file(".golb", side);
+    grid.saveBinary(file.getName());
+    for (auto _ : state) {
+        grid.loadBinary(file.getName());
+    }
+    state.SetBytesProcessed(file.size() * state.iterations());
+    reportCells(state, static_cast<std::int64_t>(side) * side);
+}
+
+} // namespace
+
+BENCHMARK(BM_LoadText)->ArgName("cote")->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadRLE)->ArgName("cote")->RangeMultiplier(4)->Range(64, 16384)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadBinary)->ArgName("cote")->RangeMultiplier(4)->Range(64, 16384)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,87 @@
+// benchmark/RenderBenchmark.cpp
+#include "Boards.h"
+#include "Image.h"
+#include "DensityMipmap.h"
+#include "Palette.h"
+#include <vector>
+#include <algorithm>
+
+namespace {
+
+// Pixels RVBA d'un instantané, un bloc de scale x scale cellules par pixel (export d'images)
+void BM_RenderRows(benchmark::State& state) {
+    int side = static_cast<int>(state.range(0));
+    int scale = static_cast<int>(state.range(1));
+    Grid grid(side, side);
+    fillRandom(grid, 35);
+    GridSnapshot snapshot = grid.snapshot();
+    int pixels = (side + scale - 1) / scale;
+    std::vector<unsigned char> buffer(static_cast<std::size_t>(pixels) * pixels * 4);
+    for (auto _ : state) {
+        Image::renderRows(snapshot, scale, 0, pixels, buffer.data(), 4);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    reportCells(state, static_cast<std::int64_t>(side) * side);
+}
+
+// Mise à jour de la pyramide de densité après une génération (seules les tuiles modifiées)
+void BM_MipmapUpdate(benchmark::State& state) {
+    int side = static_cast<int>(state.range(0));
+    Grid grid(side, side);
+    grid.setHistoryLimit(1);
+    fillRandom(grid, static_cast<int>(state.range(1)));
+    DensityMipmap mipmap;
+    mipmap.update(grid.snapshot());
+    for (auto _ : state) {
+        state.PauseTiming();
+        grid.update();
+        GridSnapshot snapshot = grid.snapshot();
+        state.ResumeTiming();
+        mipmap.update(snapshot);
+    }
+    reportCells(state, static_cast<std::int64_t>(side) * side);
+}
+
+// Tampon de la texture d'affichage vu de loin : un bloc de la pyramide par pixel, colorié par la palette
+void BM_MipmapPixels(benchmark::State& state) {
+    int side = static_cast<int>(state.range(0));
+    int level = static_cast<int>(state.range(1));
+    Grid grid(side, side);
+    grid.setCounterMode(state.range(2) != 0 ? GridSnapshot::ACTIVITE : GridSnapshot::AUCUN);
+    fillRandom(grid, 35);
+    grid.update();
+    DensityMipmap mipmap;
+    GridSnapshot snapshot = grid.snapshot();
+    mipmap.update(snapshot);
+
+    int rows = mipmap.getLevelRows(level);
+    int cols = mipmap.getLevelCols(level);
+    int blockSide = 1 << level;
+    std::vector<unsigned char> buffer(static_cast<std::size_t>(rows) * cols * 4);
+    for (auto _ : state) {
+        unsigned char* pixel = buffer.data();
+        for (int r = 0; r < rows; ++r) {
+            for (int c = 0; c < cols; ++c, pixel += 4) {
+                unsigned count = static_cast<unsigned>((std::min(side, (r + 1) * blockSide) - r * blockSide) *
+                                                       (std::min(side, (c + 1) * blockSide) - c * blockSide));
+                Palette::blockColor(snapshot.getCounters(), count, mipmap.alive(level, r, c), mipmap.obstacles(level, r, c),
+                                    mipmap.counterSum(level, r, c), pixel);
+                pixel[3] = 255;
+            }
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    reportCells(state, static_cast<std::int64_t>(side) * side);
+}
+
+} // namespace
+
+BENCHMARK(BM_RenderRows)->ArgNames({ "cote", "echelle" })
+    ->Args({ 256, 1 })->Args({ 1024, 1 })->Args({ 4096, 1 })->Args({ 4096, 4 })->Args({ 16384, 16 })
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MipmapUpdate)->ArgNames({ "cote", "densite" })
+    ->Args({ 1024, 5 })->Args({ 1024, 35 })->Args({ 4096, 35 })->Args({ 16384, 35 })
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MipmapPixels)->ArgNames({ "cote", "niveau", "activite" })
+    ->Args({ 4096, 2, 0 })->Args({ 4096, 2, 1 })->Args({ 16384, 4, 0 })->Args({ 16384, 4, 1 })
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,187 @@
+// components/BinarySnapshot.cpp
+#include "BinarySnapshot.h"
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+
+namespace {
+
+const char MAGIC[4] = { 'G', 'O', 'L', 'B' };
+const uint16_t VERSION = 1;
+const uint16_t FLAG_COMPRESSED = 1;
+const uint8_t TOPOLOGY_BOUNDED = 0;
+const uint8_t TOPOLOGY_TORIC = 1;
+
+// En-tête de 64 octets ; les plans commencent alignés sur 8 octets
+struct Header {
+    char magic[4];
+    uint16_t version;
+    uint16_t flags;
+    uint32_t rows;
+    uint32_t cols;
+    uint16_t birth;
+    uint16_t survival;
+    uint8_t topology;
+    uint8_t reserved[3];
+    int64_t generation;
+    uint64_t hash;
+    uint64_t payloadSize; // Octets de plans (après compression éventuelle)
+    uint64_t reserved2[2];
+};
+
+static_assert(sizeof(Header) == 64, "En-tête d'instantané de 64 octets attendu");
+
+// Compression par plages d'octets : n < 128 : n + 1 octets littéraux ; n >= 128 : n - 126 répétitions
+void compressBytes(const unsigned char* in, size_t size, vector<unsigned char>& out) {
+    size_t i = 0;
+    while (i < size) {
+        size_t run = 1;
+        while (i + run < size && run < 129 && in[i + run] == in[i]) ++run;
+        if (run >= 2) {
+            out.push_back(static_cast<unsigned char>(run + 126));
+            out.push_back(in[i]);
+            i += run;
+            continue;
+        }
+        size_t start = i;
+        size_t literal = 0;
+        while (i < size && literal < 128) {
+            if (i + 1 < size && in[i + 1] == in[i]) break; // Une plage commence
+            ++i;
+            ++literal;
+        }
+        out.push_back(static_cast<unsigned char>(literal - 1));
+        out.insert(out.end(), in + start, in + start + literal);
+    }
+}
+
+bool decompressBytes(const unsigned char* in, size_t size, unsigned char* out, size_t outSize) {
+    const unsigned char* end = in + size;
+    size_t written = 0;
+    while (in < end) {
+        unsigned control = *in++;
+        if (control < 128) {
+            size_t literal = control + 1;
+            if (static_cast<size_t>(end - in) < literal || written + literal > outSize) return false;
+            memcpy(out + written, in, literal);
+            in += literal;
+            written += literal;
+        }
+        else {
+            size_t run = control - 126;
+            if (in == end || written + run > outSize) return false;
+            memset(out + written, *in++, run);
+            written += run;
+        }
+    }
+    return written == outSize;
+}
+
+} // namespace
+
+// Empreinte d'une grille à partir de ses plans de bits
+uint64_t BinarySnapshot::hash(int rows, int cols, const uint64_t* alive, const uint64_t* obstacles, size_t wordCount) {
+    uint64_t seed = (static_cast<uint64_t>(static_cast<uint32_t>(rows)) << 32) | static_cast<uint32_t>(cols);
+    uint64_t h = BitPlane::hashWords(alive, wordCount, seed);
+    return BitPlane::hashWords(obstacles, wordCount, h);
+}
+
+// Enregistre un motif au format binaire
+void BinarySnapshot::save(const string& filename, const Pattern& pattern, bool toric, long long generation, bool compress) {
+    const BitPlane& alive = pattern.alive;
+    const BitPlane& obstacles = pattern.obstacles;
+    size_t planeBytes = alive.getWordCount() * sizeof(uint64_t);
+
+    Header header = {};
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.rows = static_cast<uint32_t>(alive.getRows());
+    header.cols = static_cast<uint32_t>(alive.getCols());
+    header.birth = static_cast<uint16_t>(pattern.rule.getBirthMask());
+    header.survival = static_cast<uint16_t>(pattern.rule.getSurvivalMask());
+    header.topology = toric ? TOPOLOGY_TORIC : TOPOLOGY_BOUNDED;
+    header.generation = generation;
+    header.hash = hash(alive.getRows(), alive.getCols(), alive.data(), obstacles.data(), alive.getWordCount());
+
+    vector<unsigned char> packed;
+    if (compress) {
+        compressBytes(reinterpret_cast<const unsigned char*>(alive.data()), planeBytes, packed);
+        compressBytes(reinterpret_cast<const unsigned char*>(obstacles.data()), planeBytes, packed);
+        header.flags = FLAG_COMPRESSED;
+        header.payloadSize = packed.size();
+    }
+    else {
+        header.payloadSize = 2 * planeBytes;
+    }
+
+    FILE* file = fopen(filename.c_str(), "wb");
+    if (!file) {
+        throw runtime_error("Impossible de créer le fichier d'instantané.");
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    if (compress) {
+        ok = ok && (packed.empty() || fwrite(packed.data(), packed.size(), 1, file) == 1);
+    }
+    else if (planeBytes > 0) {
+        ok = ok && fwrite(alive.data(), planeBytes, 1, file) == 1;
+        ok = ok && fwrite(obstacles.data(), planeBytes, 1, file) == 1;
+    }
+    ok = fclose(file) == 0 && ok;
+    if (!ok) {
+        throw runtime_error("Erreur d'écriture du fichier d'instantané.");
+    }
+}
+
+// Ouvre et valide un instantané binaire
+BinarySnapshot::BinarySnapshot(const string& filename)
+    : alive(nullptr), obstacles(nullptr), rows(0), cols(0), wordsPerRow(0), toric(false), generation(0), fileHash(0) {
+    file.open(filename);
+    Header header;
+    if (file.size() < sizeof(header)) {
+        throw runtime_error("Fichier d'instantané invalide.");
+    }
+    memcpy(&header, file.data(), sizeof(header));
+    if (memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw runtime_error("Fichier d'instantané invalide.");
+    }
+    if (header.version != VERSION) {
+        throw runtime_error("Version d'instantané non prise en charge.");
+    }
+
+    rows = static_cast<int>(header.rows);
+    cols = static_cast<int>(header.cols);
+    wordsPerRow = (cols + 63) / 64;
+    rule = Rule(header.birth, header.survival);
+    toric = header.topology == TOPOLOGY_TORIC;
+    generation = header.generation;
+    fileHash = header.hash;
+
+    size_t wordCount = static_cast<size_t>(rows) * wordsPerRow;
+    size_t planeBytes = wordCount * sizeof(uint64_t);
+    const unsigned char* payload = reinterpret_cast<const unsigned char*>(file.data()) + sizeof(header);
+    if (file.size() - sizeof(header) < header.payloadSize) {
+        throw runtime_error("Fichier d'instantané tronqué.");
+    }
+
+    if (header.flags & FLAG_COMPRESSED) {
+        decompressed.resize(2 * wordCount);
+        if (!decompressBytes(payload, static_cast<size_t>(header.payloadSize),
+                             reinterpret_cast<unsigned char*>(decompressed.data()), 2 * planeBytes)) {
+            throw runtime_error("Fichier d'instantané corrompu.");
+        }
+        alive = decompressed.data();
+    }
+    else {
+        if (header.payloadSize != 2 * planeBytes) {
+            throw runtime_error("Fichier d'instantané corrompu.");
+        }
+        alive = reinterpret_cast<const uint64_t*>(payload); // Lecture directe dans la projection
+    }
+    obstacles = alive + wordCount;
+
+    if (hash(rows, cols, alive, obstacles, wordCount) != fileHash) {
+        throw runtime_error("Empreinte de l'instantané incorrecte.");
+    }
+}
@@ -0,0 +1,89 @@
+// components/BinarySnapshot.h
+#ifndef BINARYSNAPSHOT_H
+#define BINARYSNAPSHOT_H
+
+#include "RLE.h"
+#include "Rule.h"
+#include "MappedFile.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief Format binaire versionné pour sauvegarder et recharger une grille.
+ *
+ * Un en-tête de 64 octets (dimensions, règle, topologie, génération,
+ * empreinte) est suivi de deux plans de bits : cellules vivantes puis
+ * obstacles. Les plans peuvent être compressés par plages d'octets
+ * (type PackBits, sans dépendance externe).
+ *
+ * Le fichier est projeté en mémoire : sans compression, les lignes des
+ * plans sont lues directement dans la projection, sans copie.
+ */
+class BinarySnapshot {
+public:
+    /**
+     * @brief Ouvre et valide un instantané binaire.
+     *
+     * @param filename Nom du fichier.
+     * @throws std::runtime_error Si le fichier est absent, d'une version inconnue ou corrompu.
+     */
+    explicit BinarySnapshot(const std::string& filename);
+
+    /**
+     * @brief Enregistre un motif au format binaire.
+     *
+     * @param filename Nom du fichier.
+     * @param pattern Cellules vivantes, obstacles et règle.
+     * @param toric Topologie torique.
+     * @param generation Numéro de la génération.
+     * @param compress Compresser les plans par plages d'octets.
+     * @throws std::runtime_error Si le fichier ne peut pas être écrit.
+     */
+    static void save(const std::string& filename, const Pattern& pattern, bool toric, long long generation, bool compress);
+
+    /**
+     * @brief Empreinte d'une grille à partir de ses plans de bits.
+     *
+     * @param rows Nombre de lignes.
+     * @param cols Nombre de colonnes.
+     * @param alive Mots du plan des cellules vivantes.
+     * @param obstacles Mots du plan des obstacles.
+     * @param wordCount Nombre de mots de chaque plan.
+     */
+    static std::uint64_t hash(int rows, int cols, const std::uint64_t* alive, const std::uint64_t* obstacles, std::size_t wordCount);
+
+    /**
+     * @brief Mots d'une ligne du plan des cellules vivantes.
+     */
+    const std::uint64_t* aliveRow(int row) const { return alive + static_cast<std::size_t>(row) * wordsPerRow; }
+
+    /**
+     * @brief Mots d'une ligne du plan des obstacles.
+     */
+    const std::uint64_t* obstacleRow(int row) const { return obstacles + static_cast<std::size_t>(row) * wordsPerRow; }
+
+    // Getters
+    int getRows() const { return rows; }
+    int getCols() const { return cols; }
+    int getWordsPerRow() const { return wordsPerRow; }
+    const Rule& getRule() const { return rule; }
+    bool isToric() const { return toric; }
+    long long getGeneration() const { return generation; }
+    std::uint64_t getHash() const { return fileHash; }
+
+private:
+    MappedFile file;
+    std::vector<std::uint64_t> decompressed; // Plans décompressés (si nécessaire)
+    const std::uint64_t* alive;
+    const std::uint64_t* obstacles;
+    int rows;
+    int cols;
+    int wordsPerRow;
+    Rule rule;
+    bool toric;
+    long long generation;
+    std::uint64_t fileHash;
+};
+
+#endif // BINARYSNAPSHOT_H
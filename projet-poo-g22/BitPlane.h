@@ -0,0 +1,164 @@
+// components/BitPlane.h
+#ifndef BITPLANE_H
+#define BITPLANE_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Plan de bits : une cellule par bit, lignes alignées sur des mots de 64 bits.
+ *
+ * Sert de représentation compacte pour les motifs lus et écrits dans les
+ * formats de fichiers (RLE, ...). Le bit j d'une ligne est le bit (j % 64)
+ * du mot (j / 64).
+ */
+class BitPlane {
+public:
+    BitPlane() : rows(0), cols(0), wordsPerRow(0) {}
+
+    /**
+     * @brief Construit un plan de bits entièrement à zéro.
+     *
+     * @param r Nombre de lignes.
+     * @param c Nombre de colonnes.
+     */
+    BitPlane(int r, int c) : rows(r), cols(c), wordsPerRow((c + 63) / 64),
+        words(static_cast<std::size_t>(r) * ((c + 63) / 64), 0) {}
+
+    bool get(int row, int col) const {
+        return (rowData(row)[col >> 6] >> (col & 63)) & 1;
+    }
+
+    void set(int row, int col) {
+        rowData(row)[col >> 6] |= std::uint64_t(1) << (col & 63);
+    }
+
+    void reset(int row, int col) {
+        rowData(row)[col >> 6] &= ~(std::uint64_t(1) << (col & 63));
+    }
+
+    /**
+     * @brief Met à un les bits [col, col + length) d'une ligne, mot par mot.
+     */
+    void setRun(int row, int col, int length) {
+        std::uint64_t* data = rowData(row);
+        int end = col + length;
+        while (col < end) {
+            int bit = col & 63;
+            int count = end - col < 64 - bit ? end - col : 64 - bit;
+            std::uint64_t mask = count == 64 ? ~std::uint64_t(0) : ((std::uint64_t(1) << count) - 1) << bit;
+            data[col >> 6] |= mask;
+            col += count;
+        }
+    }
+
+    /**
+     * @brief Ajoute (OU bit à bit) un autre plan dont le coin supérieur gauche est en (top, left).
+     *
+     * La copie se fait par mots décalés ; les bits qui sortent du plan sont ignorés.
+     *
+     * @param source Plan à ajouter.
+     * @param top Ligne de destination du coin supérieur gauche.
+     * @param left Colonne de destination du coin supérieur gauche (positive ou nulle).
+     */
+    void blit(const BitPlane& source, int top, int left) {
+        int first = left >> 6;
+        int shift = left & 63;
+        for (int i = 0; i < source.rows; ++i) {
+            int row = top + i;
+            if (row < 0 || row >= rows) continue;
+            const std::uint64_t* from = source.rowData(i);
+            std::uint64_t* to = rowData(row);
+            for (int w = 0; w < source.wordsPerRow; ++w) {
+                std::uint64_t word = from[w];
+                if (!word) continue;
+                int target = first + w;
+                if (target < wordsPerRow) to[target] |= word << shift;
+                if (shift && target + 1 < wordsPerRow) to[target + 1] |= word >> (64 - shift);
+            }
+            if (cols & 63) {
+                to[wordsPerRow - 1] &= (std::uint64_t(1) << (cols & 63)) - 1; // Bits au-delà de la dernière colonne
+            }
+        }
+    }
+
+    /**
+     * @brief Copie du plan tournée de quarterTurns quarts de tour (sens horaire), après un miroir horizontal éventuel.
+     *
+     * Prévu pour des motifs de petite taille (copie bit par bit).
+     */
+    BitPlane transformed(int quarterTurns, bool mirrored) const {
+        int turns = ((quarterTurns % 4) + 4) % 4;
+        BitPlane result = turns % 2 ? BitPlane(cols, rows) : BitPlane(rows, cols);
+        for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < cols; ++j) {
+                if (!get(i, j)) continue;
+                int c = mirrored ? cols - 1 - j : j;
+                switch (turns) {
+                case 0: result.set(i, c); break;
+                case 1: result.set(c, rows - 1 - i); break;
+                case 2: result.set(rows - 1 - i, cols - 1 - c); break;
+                default: result.set(cols - 1 - c, i); break;
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Position du bit de poids faible d'un mot non nul.
+     */
+    static int lowestBit(std::uint64_t word) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, word);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(word);
+#endif
+    }
+
+    /**
+     * @brief Vérifie si au moins un bit du plan est à un.
+     */
+    bool any() const {
+        for (std::uint64_t word : words) {
+            if (word) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Empreinte 64 bits d'une suite de mots (enchaînable via seed).
+     */
+    static std::uint64_t hashWords(const std::uint64_t* data, std::size_t count, std::uint64_t seed) {
+        std::uint64_t hash = seed;
+        for (std::size_t i = 0; i < count; ++i) {
+            hash = ((hash << 5) | (hash >> 59)) ^ data[i];
+            hash *= 0x9E3779B97F4A7C15ull;
+        }
+        return hash ^ (hash >> 32);
+    }
+
+    std::uint64_t* rowData(int row) { return &words[static_cast<std::size_t>(row) * wordsPerRow]; }
+    const std::uint64_t* rowData(int row) const { return &words[static_cast<std::size_t>(row) * wordsPerRow]; }
+
+    // Getters
+    int getRows() const { return rows; }
+    int getCols() const { return cols; }
+    int getWordsPerRow() const { return wordsPerRow; }
+    std::size_t getWordCount() const { return words.size(); }
+    const std::uint64_t* data() const { return words.data(); }
+
+private:
+    int rows;
+    int cols;
+    int wordsPerRow;
+    std::vector<std::uint64_t> words;
+};
+
+#endif // BITPLANE_H
@@ -0,0 +1,49 @@
+// components/BrushStroke.cpp
+#include "BrushStroke.h"
+#include <algorithm>
+#include <cstdlib>
+
+using namespace std;
+
+BrushStroke::BrushStroke() : last{ 0, 0 }, drawing(false) {}
+
+// Ajoute une position et les cellules du segment depuis la précédente
+void BrushStroke::add(int row, int col) {
+    if (drawing) {
+        int steps = max(abs(row - last.row), abs(col - last.col));
+        for (int k = 1; k < steps; ++k) {
+            Point point = { last.row + (row - last.row) * k / steps, last.col + (col - last.col) * k / steps };
+            points.push_back(point);
+        }
+    }
+    Point point = { row, col };
+    points.push_back(point);
+    last = point;
+    drawing = true;
+}
+
+// Applique le pinceau à chaque position en attente dans un plan couvrant le tracé
+bool BrushStroke::take(const BitPlane& brush, BitPlane& plane, int& top, int& left) {
+    if (points.empty()) {
+        return false;
+    }
+    int minRow = points[0].row, maxRow = points[0].row;
+    int minCol = points[0].col, maxCol = points[0].col;
+    for (const Point& point : points) {
+        minRow = min(minRow, point.row);
+        maxRow = max(maxRow, point.row);
+        minCol = min(minCol, point.col);
+        maxCol = max(maxCol, point.col);
+    }
+
+    int centerRow = brush.getRows() / 2;
+    int centerCol = brush.getCols() / 2;
+    top = minRow - centerRow;
+    left = minCol - centerCol;
+    plane = BitPlane(maxRow - minRow + brush.getRows(), maxCol - minCol + brush.getCols());
+    for (const Point& point : points) {
+        plane.blit(brush, point.row - minRow, point.col - minCol);
+    }
+    points.clear();
+    return true;
+}
@@ -0,0 +1,66 @@
+// components/BrushStroke.h
+#ifndef BRUSHSTROKE_H
+#define BRUSHSTROKE_H
+
+#include "BitPlane.h"
+#include <vector>
+
+/**
+ * @brief Tracé au pinceau regroupé en une seule modification par image.
+ *
+ * Les positions de la souris sont accumulées pendant une image (les cellules
+ * entre deux positions successives sont ajoutées pour que le tracé reste
+ * continu), puis take() produit un seul plan de bits couvrant tout le tracé :
+ * la grille n'est modifiée qu'une fois par image, quelle que soit la
+ * quantité d'événements reçus.
+ */
+class BrushStroke {
+public:
+    BrushStroke();
+
+    /**
+     * @brief Ajoute une position du pinceau (centre du pinceau, en cellules).
+     *
+     * Si le tracé n'a pas été interrompu par end(), le segment depuis la
+     * position précédente est ajouté.
+     */
+    void add(int row, int col);
+
+    /**
+     * @brief Lève le pinceau : la prochaine position commence un nouveau segment.
+     */
+    void end() { drawing = false; }
+
+    /**
+     * @brief Vérifie si des positions sont en attente.
+     */
+    bool empty() const { return points.empty(); }
+
+    /**
+     * @brief Rassemble les positions en attente dans un seul plan de bits.
+     *
+     * Le pinceau est appliqué à chaque position par mots décalés
+     * (BitPlane::blit). Les positions en attente sont ensuite oubliées ;
+     * le tracé peut continuer depuis la dernière.
+     *
+     * @param brush Forme du pinceau, centrée sur chaque position.
+     * @param plane Plan couvrant le tracé.
+     * @param top Ligne de la grille correspondant à la première ligne du plan.
+     * @param left Colonne de la grille correspondant à la première colonne du plan.
+     * @return true Si au moins une position était en attente.
+     * @return false Sinon (plane, top et left sont inchangés).
+     */
+    bool take(const BitPlane& brush, BitPlane& plane, int& top, int& left);
+
+private:
+    struct Point {
+        int row;
+        int col;
+    };
+
+    std::vector<Point> points; // Positions en attente
+    Point last; // Dernière position ajoutée
+    bool drawing; // Pinceau posé (last est valide)
+};
+
+#endif // BRUSHSTROKE_H
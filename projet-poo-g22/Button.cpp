@@ -10,7 +10,7 @@ Button::Button(float x, float y, float width, float height, sf::Font& font, cons
     // Configuration du texte
     text.setFont(font);
     text.setString(label);
-    text.setCharacterSize(static_cast<int>(height * 0.6)); // Taille relative  la hauteur du bouton
+    text.setCharacterSize(static_cast<int>(height * 0.6)); // Taille relative à la hauteur du bouton
     text.setFillColor(sf::Color::Black); // Couleur du texte
     text.setStyle(sf::Text::Bold); // Texte en gras
 
@@ -6,9 +6,9 @@
 #include <string>
 
 /**
- * @brief Classe reprsentant un bouton interactif.
+ * @brief Classe représentant un bouton interactif.
  *
- * Cette classe gre l'affichage, le changement de couleur, et la dtection des clics sur un bouton.
+ * Cette classe gère l'affichage, le changement de couleur, et la détection des clics sur un bouton.
  */
 class Button {
 private:
@@ -23,8 +23,8 @@ public:
      * @param y Position Y du bouton.
      * @param width Largeur du bouton.
      * @param height Hauteur du bouton.
-     * @param font Rfrence  la police utilise pour le texte.
-     * @param label Texte affich sur le bouton.
+     * @param font Référence à la police utilisée pour le texte.
+     * @param label Texte affiché sur le bouton.
      * @param color Couleur de remplissage du bouton.
      */
     Button(float x, float y, float width, float height, sf::Font& font, const std::string& label, const sf::Color& color);
@@ -37,18 +37,18 @@ public:
     void setColor(const sf::Color& color);
 
     /**
-     * @brief Dessine le bouton dans la fentre.
+     * @brief Dessine le bouton dans la fenêtre.
      *
-     * @param window Rfrence  la fentre SFML.
+     * @param window Référence à la fenêtre SFML.
      */
     void draw(sf::RenderWindow& window);
 
     /**
-     * @brief Vrifie si le bouton a t cliqu.
+     * @brief Vérifie si le bouton a été cliqué.
      *
      * @param mouseX Position X de la souris.
      * @param mouseY Position Y de la souris.
-     * @return true Si le bouton a t cliqu.
+     * @return true Si le bouton a été cliqué.
      * @return false Sinon.
      */
     bool isClicked(float mouseX, float mouseY);
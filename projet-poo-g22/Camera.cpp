@@ -0,0 +1,48 @@
+// interfaces/Camera.cpp
+#include "Camera.h"
+#include <algorithm>
+
+using namespace std;
+
+constexpr double Camera::MIN_CELL_SIZE;
+constexpr double Camera::MAX_CELL_SIZE;
+
+Camera::Camera(double areaWidth, double areaHeight, int gridRows, int gridCols, double overview)
+    : width(areaWidth), height(areaHeight), rows(gridRows), cols(gridCols), overviewCellSize(overview),
+      left(0), top(0), cellSize(1) {
+    reset();
+}
+
+// Vue d'ensemble : toute la grille, centrée
+void Camera::reset() {
+    double fit = min(width / max(1, cols), height / max(1, rows));
+    cellSize = max(MIN_CELL_SIZE, min(overviewCellSize, fit));
+    left = (cols - width / cellSize) / 2;
+    top = (rows - height / cellSize) / 2;
+    clamp();
+}
+
+// Zoome en gardant fixe la cellule sous le point (x, y)
+void Camera::zoom(double factor, double x, double y) {
+    double column = toColumn(x);
+    double row = toRow(y);
+    cellSize = max(MIN_CELL_SIZE, min(MAX_CELL_SIZE, cellSize * factor));
+    left = column - x / cellSize;
+    top = row - y / cellSize;
+    clamp();
+}
+
+// Déplace la vue d'un nombre de pixels
+void Camera::pan(double dx, double dy) {
+    left += dx / cellSize;
+    top += dy / cellSize;
+    clamp();
+}
+
+// Garde la grille visible : si elle est plus petite que la vue, elle reste centrée
+void Camera::clamp() {
+    double viewCols = width / cellSize;
+    double viewRows = height / cellSize;
+    left = viewCols >= cols ? (cols - viewCols) / 2 : max(0.0, min(left, cols - viewCols));
+    top = viewRows >= rows ? (rows - viewRows) / 2 : max(0.0, min(top, rows - viewRows));
+}
@@ -0,0 +1,74 @@
+// interfaces/Camera.h
+#ifndef CAMERA_H
+#define CAMERA_H
+
+/**
+ * @brief Zoom et déplacement de la vue sur la grille.
+ *
+ * La caméra associe une zone d'affichage de width x height pixels à un
+ * rectangle de cellules : left et top sont les coordonnées (en cellules)
+ * du coin supérieur gauche de la zone, cellSize la taille d'une cellule
+ * en pixels (inférieure à 1 quand la vue est éloignée).
+ */
+class Camera {
+public:
+    static constexpr double MIN_CELL_SIZE = 1.0 / 128; // Vue la plus éloignée : 128 cellules par pixel
+    static constexpr double MAX_CELL_SIZE = 64; // Vue la plus proche : 64 pixels par cellule
+
+    /**
+     * @brief Construit une caméra montrant toute la grille.
+     *
+     * @param width Largeur de la zone d'affichage en pixels.
+     * @param height Hauteur de la zone d'affichage en pixels.
+     * @param rows Nombre de lignes de la grille.
+     * @param cols Nombre de colonnes de la grille.
+     * @param cellSize Taille maximale d'une cellule pour la vue d'ensemble.
+     */
+    Camera(double width, double height, int rows, int cols, double cellSize);
+
+    /**
+     * @brief Revient à la vue d'ensemble de la grille.
+     */
+    void reset();
+
+    /**
+     * @brief Zoome en gardant fixe la cellule sous le point (x, y).
+     *
+     * @param factor Facteur multiplicatif de la taille des cellules.
+     * @param x Abscisse du point fixe, en pixels dans la zone d'affichage.
+     * @param y Ordonnée du point fixe, en pixels dans la zone d'affichage.
+     */
+    void zoom(double factor, double x, double y);
+
+    /**
+     * @brief Déplace la vue d'un nombre de pixels.
+     */
+    void pan(double dx, double dy);
+
+    /**
+     * @brief Convertit un point de la zone d'affichage en coordonnées de cellule.
+     */
+    double toColumn(double x) const { return left + x / cellSize; }
+    double toRow(double y) const { return top + y / cellSize; }
+
+    // Getters
+    double getLeft() const { return left; }
+    double getTop() const { return top; }
+    double getCellSize() const { return cellSize; }
+    double getWidth() const { return width; }
+    double getHeight() const { return height; }
+
+private:
+    double width;
+    double height;
+    int rows;
+    int cols;
+    double overviewCellSize; // Taille maximale des cellules en vue d'ensemble
+    double left;
+    double top;
+    double cellSize;
+
+    void clamp();
+};
+
+#endif // CAMERA_H
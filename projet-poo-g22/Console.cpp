@@ -1,64 +1,131 @@
 // interfaces/Console.cpp
 #include "Console.h"
+#include "TerminalRenderer.h"
+#include "Trace.h"
 #include <iostream>
 #include <thread>
 #include <chrono>
-#include <fstream> // Ajouter pour la gestion de fichier
+#include <memory>
+#include <stdexcept>
+#include <algorithm>
 
 using namespace std;
 
+ConsoleInterface::ConsoleInterface(OutputWriter::Format format) : outputFormat(format) {}
+
 void ConsoleInterface::run(Grid& grid, int delay, int maxIterations) {
-    // Effacer le fichier de sortie avant de commencer une nouvelle excution
-    ofstream outputFile("output.txt", ios::trunc);  // Ouvre le fichier en mode troncature
-    if (!outputFile.is_open()) {
+    // Effacer le fichier de sortie avant de commencer une nouvelle exécution
+    // (l'écriture se fait sur un thread dédié pour ne pas ralentir la simulation)
+    unique_ptr<OutputWriter> outputFile;
+    try {
+        if (outputFormat == OutputWriter::DELTA) {
+            outputFile.reset(new OutputWriter("output.delta", OutputWriter::DELTA));
+        }
+        else {
+            outputFile.reset(new OutputWriter("output.txt"));
+        }
+    }
+    catch (const runtime_error&) {
         cerr << "Impossible d'ouvrir le fichier de sortie." << endl;
         return;
     }
 
-    // Demander  l'utilisateur de spcifier le nombre d'itrations (s'il n'est pas dfini)
+    // Demander à l'utilisateur de spécifier le nombre d'itérations (s'il n'est pas défini)
     if (maxIterations == 0) {
-        cout << "Entrez le nombre d'itrations (0 pour illimit): ";
+        cout << "Entrez le nombre d'itérations (0 pour illimité): ";
         while (!(cin >> maxIterations) || maxIterations < 0) {
             cout << "Veuillez entrer un nombre entier positif valide: ";
-            cin.clear();  // Enlever l'tat d'erreur
-            cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Ignorer les mauvaises entres
+            cin.clear();  // Enlever l'état d'erreur
+            cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Ignorer les mauvaises entrées
         }
     }
 
+    // Dans un terminal, seuls les caractères modifiés sont redessinés ; sinon la grille est imprimée en texte
+    unique_ptr<TerminalRenderer> terminal;
+    unique_ptr<TerminalInput> keyboard;
+    if (TerminalRenderer::isTerminal()) {
+        terminal.reset(new TerminalRenderer());
+        keyboard.reset(new TerminalInput());
+    }
+
+    // Durées d'affichage et d'écriture enregistrées si la grille a des mesures
+    shared_ptr<Metrics> metrics = grid.getMetrics();
+
+    GridSnapshot shown = grid.snapshot();
     int iterationsCount = 0;
+    bool stable = false;
+    bool stopped = false;
     while (maxIterations == 0 || iterationsCount < maxIterations) {
-        grid.print();  // Afficher la grille dans la console
-        grid.update();  // Mettre  jour la grille
+        // Afficher la grille dans la console
+        long long shownGeneration = grid.getGeneration();
+        chrono::steady_clock::time_point rendered = chrono::steady_clock::now();
+        if (terminal) {
+            terminal->render(shown, shownGeneration);
+        }
+        else {
+            TRACE_SPAN("Grid::print");
+            grid.print();
+        }
+        if (metrics) {
+            metrics->recordTime(Metrics::RENDU, chrono::duration<double>(chrono::steady_clock::now() - rendered).count());
+        }
+        grid.update();  // Mettre à jour la grille
         iterationsCount++;
 
-        // Sauvegarder l'tat de la grille aprs chaque itration
-        for (int i = 0; i < grid.getRows(); ++i) {
-            for (int j = 0; j < grid.getCols(); ++j) {
-                if (grid.getCellState(i, j) == VIVANT) {
-                    outputFile << "1 ";
-                }
-                else if (grid.getCellState(i, j) == OBSTACLE) {
-                    outputFile << "X ";
-                }
-                else {
-                    outputFile << "0 ";
-                }
-            }
-            outputFile << endl;
+        // Sauvegarder l'état de la grille après chaque itération
+        chrono::steady_clock::time_point written = chrono::steady_clock::now();
+        GridSnapshot snapshot = grid.snapshot();
+        {
+            TRACE_SPAN("ConsoleInterface::write");
+            outputFile->write(snapshot, grid.getGeneration());
+        }
+        if (metrics) {
+            metrics->recordTime(Metrics::ENTREES_SORTIES, chrono::duration<double>(chrono::steady_clock::now() - written).count());
         }
-        outputFile << "-----------------------" << endl; // Sparateur entre les tats
 
-        // Vrifier si l'automate est stable
+        // Vérifier si l'automate est stable
         if (grid.hasStableState()) {
-            cout << "La grille a atteint un tat stable. Fin de la simulation." << endl;
+            stable = true;
             break;
         }
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+        // Attendre le délai en lisant le clavier (flèches : défilement, q : arrêt)
+        TRACE_SPAN("ConsoleInterface::delay");
+        auto deadline = chrono::steady_clock::now() + chrono::milliseconds(delay);
+        do {
+            int key = keyboard ? keyboard->poll() : TerminalInput::AUCUNE;
+            if (key == 'q' || key == 'Q') {
+                stopped = true;
+                break;
+            }
+            if (key >= TerminalInput::HAUT) {
+                long long rows = max(1, terminal->getViewRows() / 4);
+                long long cols = max(1, terminal->getViewCols() / 4);
+                terminal->scroll(key == TerminalInput::HAUT ? -rows : key == TerminalInput::BAS ? rows : 0,
+                                 key == TerminalInput::GAUCHE ? -cols : key == TerminalInput::DROITE ? cols : 0);
+                terminal->render(shown, shownGeneration);
+                continue;
+            }
+            auto remaining = deadline - chrono::steady_clock::now();
+            this_thread::sleep_for(min<chrono::steady_clock::duration>(remaining, chrono::milliseconds(keyboard ? 10 : delay)));
+        } while (chrono::steady_clock::now() < deadline);
+        if (stopped) {
+            break;
+        }
+        shown = snapshot;
     }
 
-    cout << "Simulation termine aprs " << iterationsCount << " itrations." << endl;
+    if (terminal) {
+        terminal->render(grid.snapshot(), grid.getGeneration());
+        terminal->finish();
+    }
+    if (stable) {
+        cout << "La grille a atteint un état stable. Fin de la simulation." << endl;
+    }
+    cout << "Simulation terminée après " << iterationsCount << " itérations." << endl;
 
-    // Fermer le fichier aprs l'criture
-    outputFile.close();
+    // Fermer le fichier après l'écriture de toutes les générations
+    if (!outputFile->close()) {
+        cerr << "Erreur d'écriture du fichier de sortie." << endl;
+    }
 }
\ No newline at end of file
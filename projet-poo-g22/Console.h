@@ -0,0 +1,38 @@
+// interfaces/Console.h
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include "SimulationInterface.h"
+#include "OutputWriter.h"
+#include <string>
+
+/**
+ * @brief Interface console pour la simulation.
+ *
+ * Cette classe gère l'affichage et la mise à jour de la grille dans la console.
+ * Chaque génération est enregistrée dans output.txt (grille complète) ou,
+ * en format DELTA, dans le journal output.delta.
+ */
+class ConsoleInterface : public SimulationInterface {
+public:
+    /**
+     * @brief Construit l'interface console.
+     *
+     * @param format Format du fichier de sortie.
+     */
+    explicit ConsoleInterface(OutputWriter::Format format = OutputWriter::TEXTE);
+
+    /**
+     * @brief Exécute la simulation en mode console.
+     *
+     * @param grid Référence vers la grille de simulation.
+     * @param delay Délai entre chaque itération en millisecondes.
+     * @param maxIterations Nombre maximal d'itérations (0 pour infini).
+     */
+    void run(Grid& grid, int delay, int maxIterations) override;
+
+private:
+    OutputWriter::Format outputFormat;
+};
+
+#endif // CONSOLE_H
@@ -0,0 +1,152 @@
+// components/DeltaLogReader.cpp
+#include "DeltaLogReader.h"
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+namespace {
+
+// Curseur de lecture dans la projection
+struct Cursor {
+    const char* position;
+    const char* end;
+
+    void skipSpaces() {
+        while (position < end && (*position == ' ' || *position == '\t' || *position == '\r')) ++position;
+    }
+
+    bool number(long long& value) {
+        skipSpaces();
+        bool negative = position < end && *position == '-';
+        if (negative) ++position;
+        if (position == end || *position < '0' || *position > '9') return false;
+        value = 0;
+        while (position < end && *position >= '0' && *position <= '9') {
+            value = value * 10 + (*position++ - '0');
+        }
+        if (negative) value = -value;
+        return true;
+    }
+
+    // Passe count lignes ; false si le fichier se termine avant
+    bool skipLines(size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            const char* newline = static_cast<const char*>(memchr(position, '\n', static_cast<size_t>(end - position)));
+            if (!newline) return false;
+            position = newline + 1;
+        }
+        return true;
+    }
+};
+
+CellState cellFromToken(char token) {
+    if (token == '1') return VIVANT;
+    if (token == 'X' || token == 'x') return OBSTACLE;
+    return VIDE;
+}
+
+} // namespace
+
+// Ouvre et indexe un journal delta
+DeltaLogReader::DeltaLogReader(const string& filename) : rows(0), cols(0) {
+    file.open(filename);
+    scanRecords();
+}
+
+// Construit l'index en parcourant les en-têtes d'enregistrements
+void DeltaLogReader::scanRecords() {
+    Cursor cursor = { file.data(), file.data() + file.size() };
+    long long r = 0;
+    long long c = 0;
+    if (file.size() < 5 || memcmp(cursor.position, "DELTA", 5) != 0) {
+        throw runtime_error("Journal delta invalide.");
+    }
+    cursor.position += 5;
+    if (!cursor.number(r) || !cursor.number(c) || r < 0 || c < 0 || !cursor.skipLines(1)) {
+        throw runtime_error("Journal delta invalide.");
+    }
+    rows = static_cast<int>(r);
+    cols = static_cast<int>(c);
+
+    while (cursor.position < cursor.end) {
+        char type = *cursor.position++;
+        Record record = {};
+        long long count = 0;
+        if ((type != 'K' && type != 'D') || !cursor.number(record.generation) ||
+            (type == 'D' && (!cursor.number(count) || count < 0 || records.empty())) ||
+            (!records.empty() && record.generation <= records.back().generation) ||
+            !cursor.skipLines(1)) {
+            break; // Enregistrement incomplet ou inattendu : fin du journal exploitable
+        }
+        record.offset = static_cast<size_t>(cursor.position - file.data());
+        record.count = static_cast<size_t>(count);
+        record.keyframe = type == 'K' ? records.size() : records.back().keyframe;
+        if (!cursor.skipLines(type == 'K' ? static_cast<size_t>(rows) : record.count)) {
+            break;
+        }
+        records.push_back(record);
+    }
+}
+
+// Indice de l'enregistrement d'une génération (records.size() si absente)
+size_t DeltaLogReader::find(long long generation) const {
+    vector<Record>::const_iterator it = lower_bound(records.begin(), records.end(), generation,
+        [](const Record& record, long long value) { return record.generation < value; });
+    if (it == records.end() || it->generation != generation) {
+        return records.size();
+    }
+    return static_cast<size_t>(it - records.begin());
+}
+
+// Vérifie si une génération est présente dans le journal
+bool DeltaLogReader::contains(long long generation) const {
+    return find(generation) < records.size();
+}
+
+// Reconstruit l'état d'une génération : image clé puis deltas successifs
+bool DeltaLogReader::read(long long generation, vector<CellState>& cells) const {
+    size_t target = find(generation);
+    if (target == records.size()) {
+        return false;
+    }
+    cells.assign(static_cast<size_t>(rows) * cols, VIDE);
+    size_t keyframe = records[target].keyframe;
+    decodeKeyframe(records[keyframe], cells);
+    for (size_t i = keyframe + 1; i <= target; ++i) {
+        applyDelta(records[i], cells);
+    }
+    return true;
+}
+
+// Lit la grille complète d'une image clé (mêmes jetons que le format texte)
+void DeltaLogReader::decodeKeyframe(const Record& record, vector<CellState>& cells) const {
+    const char* position = file.data() + record.offset;
+    for (int i = 0; i < rows; ++i) {
+        const char* newline = static_cast<const char*>(memchr(position, '\n', static_cast<size_t>(file.data() + file.size() - position)));
+        CellState* row = cells.data() + static_cast<size_t>(i) * cols;
+        int j = 0;
+        for (const char* p = position; p < newline && j < cols; ++p) {
+            if (*p != ' ' && *p != '\t' && *p != '\r') {
+                row[j++] = cellFromToken(*p);
+            }
+        }
+        position = newline + 1;
+    }
+}
+
+// Applique les cellules modifiées d'un delta
+void DeltaLogReader::applyDelta(const Record& record, vector<CellState>& cells) const {
+    Cursor cursor = { file.data() + record.offset, file.data() + file.size() };
+    for (size_t k = 0; k < record.count; ++k) {
+        long long row = 0;
+        long long col = 0;
+        if (!cursor.number(row) || !cursor.number(col) || row < 0 || row >= rows || col < 0 || col >= cols) {
+            throw runtime_error("Journal delta corrompu.");
+        }
+        cursor.skipSpaces();
+        cells[static_cast<size_t>(row) * cols + static_cast<size_t>(col)] = cellFromToken(*cursor.position);
+        cursor.skipLines(1);
+    }
+}
@@ -0,0 +1,80 @@
+// components/DeltaLogReader.h
+#ifndef DELTALOGREADER_H
+#define DELTALOGREADER_H
+
+#include "Cellule.h"
+#include "MappedFile.h"
+#include <string>
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief Lecteur du journal delta écrit par OutputWriter (format DELTA).
+ *
+ * Le journal commence par « DELTA <lignes> <colonnes> » puis contient un
+ * enregistrement par génération : une image clé (« K <génération> » suivi
+ * de la grille complète) ou la liste des cellules modifiées depuis la
+ * génération précédente (« D <génération> <n> » suivi de n lignes
+ * « <ligne> <colonne> <état> »).
+ *
+ * Le fichier est projeté en mémoire et indexé à l'ouverture ; relire une
+ * génération coûte une image clé et les deltas qui la suivent. Un
+ * enregistrement incomplet en fin de fichier (exécution interrompue) est
+ * ignoré.
+ */
+class DeltaLogReader {
+public:
+    /**
+     * @brief Ouvre et indexe un journal delta.
+     *
+     * @param filename Nom du fichier.
+     * @throws std::runtime_error Si le fichier est absent ou invalide.
+     */
+    explicit DeltaLogReader(const std::string& filename);
+
+    /**
+     * @brief Reconstruit l'état d'une génération.
+     *
+     * @param generation Numéro de la génération.
+     * @param cells Cellules de destination (ligne par ligne), redimensionnées si nécessaire.
+     * @return true Si la génération est présente dans le journal.
+     * @return false Sinon.
+     * @throws std::runtime_error Si un enregistrement est corrompu.
+     */
+    bool read(long long generation, std::vector<CellState>& cells) const;
+
+    /**
+     * @brief Vérifie si une génération est présente dans le journal.
+     */
+    bool contains(long long generation) const;
+
+    // Getters
+    int getRows() const { return rows; }
+    int getCols() const { return cols; }
+    std::size_t getRecordCount() const { return records.size(); }
+    long long getFirstGeneration() const { return records.empty() ? 0 : records.front().generation; }
+    long long getLastGeneration() const { return records.empty() ? 0 : records.back().generation; }
+
+private:
+    /**
+     * @brief Entrée de l'index : génération, début des données et image clé de référence.
+     */
+    struct Record {
+        long long generation;
+        std::size_t offset; // Début de la ligne qui suit l'en-tête de l'enregistrement
+        std::size_t count; // Cellules modifiées (delta)
+        std::size_t keyframe; // Indice de l'image clé dont dépend l'enregistrement
+    };
+
+    MappedFile file;
+    int rows;
+    int cols;
+    std::vector<Record> records;
+
+    void scanRecords();
+    std::size_t find(long long generation) const;
+    void decodeKeyframe(const Record& record, std::vector<CellState>& cells) const;
+    void applyDelta(const Record& record, std::vector<CellState>& cells) const;
+};
+
+#endif // DELTALOGREADER_H
@@ -0,0 +1,122 @@
+// components/DensityMipmap.cpp
+#include "DensityMipmap.h"
+#include <algorithm>
+
+using namespace std;
+
+DensityMipmap::DensityMipmap() {
+    for (Level& level : levels) {
+        level.rows = 0;
+        level.cols = 0;
+    }
+}
+
+// Compte les blocs de 2 x 2 cellules d'une tuile (niveau 1)
+void DensityMipmap::countTile(const GridSnapshot& snapshot, int tileRow, int tileCol) {
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    Level& level = levels[0];
+    const unsigned char* cells = snapshot.getTile(tileRow, tileCol)->cells;
+    const unsigned char* counters = snapshot.getCounterTile(tileRow, tileCol)->cells;
+    bool counting = !level.counters.empty();
+    int firstRow = tileRow * tileSize / 2;
+    int firstCol = tileCol * tileSize / 2;
+    int height = min(tileSize / 2, level.rows - firstRow);
+    int width = min(tileSize / 2, level.cols - firstCol);
+    // Les cellules de remplissage des tuiles du bord sont VIDE : elles ne comptent pas
+    for (int i = 0; i < height; ++i) {
+        const unsigned char* upper = cells + 2 * i * tileSize;
+        const unsigned char* lower = upper + tileSize;
+        size_t out = static_cast<size_t>(firstRow + i) * level.cols + firstCol;
+        for (int j = 0; j < width; ++j, ++out) {
+            unsigned alive = 0;
+            unsigned obstacles = 0;
+            unsigned char block[4] = { upper[2 * j], upper[2 * j + 1], lower[2 * j], lower[2 * j + 1] };
+            for (unsigned char state : block) {
+                alive += state == VIVANT;
+                obstacles += state == OBSTACLE;
+            }
+            level.alive[out] = static_cast<uint16_t>(alive);
+            level.obstacles[out] = static_cast<uint16_t>(obstacles);
+            if (counting) {
+                const unsigned char* upperCounters = counters + 2 * i * tileSize + 2 * j;
+                const unsigned char* lowerCounters = upperCounters + tileSize;
+                level.counters[out] = upperCounters[0] + upperCounters[1] + lowerCounters[0] + lowerCounters[1];
+            }
+        }
+    }
+}
+
+// Recalcule les blocs [firstRow, lastRow) x [firstCol, lastCol) d'un niveau à partir du précédent
+void DensityMipmap::reduce(int level, int firstRow, int lastRow, int firstCol, int lastCol) {
+    Level& parent = levels[level - 1];
+    const Level& child = levels[level - 2];
+    lastRow = min(lastRow, parent.rows);
+    lastCol = min(lastCol, parent.cols);
+    for (int r = firstRow; r < lastRow; ++r) {
+        for (int c = firstCol; c < lastCol; ++c) {
+            unsigned alive = 0;
+            unsigned obstacles = 0;
+            uint32_t counters = 0;
+            for (int i = 2 * r; i < min(2 * r + 2, child.rows); ++i) {
+                for (int j = 2 * c; j < min(2 * c + 2, child.cols); ++j) {
+                    size_t k = static_cast<size_t>(i) * child.cols + j;
+                    alive += child.alive[k];
+                    obstacles += child.obstacles[k];
+                    if (!child.counters.empty()) {
+                        counters += child.counters[k];
+                    }
+                }
+            }
+            size_t out = static_cast<size_t>(r) * parent.cols + c;
+            parent.alive[out] = static_cast<uint16_t>(alive);
+            parent.obstacles[out] = static_cast<uint16_t>(obstacles);
+            if (!parent.counters.empty()) {
+                parent.counters[out] = counters;
+            }
+        }
+    }
+}
+
+// Recompte les tuiles modifiées puis les blocs qui les contiennent, niveau par niveau
+void DensityMipmap::update(const GridSnapshot& snapshot) {
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    int rows = snapshot.getRows();
+    int cols = snapshot.getCols();
+    if (rows != previous.getRows() || cols != previous.getCols()) {
+        for (int k = 1; k <= LEVELS; ++k) {
+            Level& level = levels[k - 1];
+            level.rows = (rows + (1 << k) - 1) >> k;
+            level.cols = (cols + (1 << k) - 1) >> k;
+            level.alive.assign(static_cast<size_t>(level.rows) * level.cols, 0);
+            level.obstacles.assign(level.alive.size(), 0);
+            level.counters.clear(); // Réalloués ci-dessous si nécessaire
+        }
+        previous = GridSnapshot(rows, cols); // Comptes nuls : seules les tuiles non vides sont à compter
+    }
+    if ((snapshot.getCounters() != GridSnapshot::AUCUN) != !levels[0].counters.empty()) {
+        // Compteurs apparus ou disparus : changedTiles() liste alors toutes les tuiles
+        for (Level& level : levels) {
+            level.counters.assign(snapshot.getCounters() != GridSnapshot::AUCUN ? level.alive.size() : 0, 0);
+        }
+    }
+
+    snapshot.changedTiles(previous, changedTiles);
+    for (int tile : changedTiles) {
+        countTile(snapshot, tile / snapshot.getTileCols(), tile % snapshot.getTileCols());
+    }
+
+    for (int k = 2; k <= LEVELS; ++k) {
+        int side = 1 << k;
+        for (int tile : changedTiles) {
+            int tr = tile / snapshot.getTileCols();
+            int tc = tile % snapshot.getTileCols();
+            // Blocs du niveau k recouvrant la tuile (un bloc peut recouvrir plusieurs tuiles)
+            int firstRow = tr * tileSize / side;
+            int firstCol = tc * tileSize / side;
+            int lastRow = ((tr + 1) * tileSize + side - 1) / side;
+            int lastCol = ((tc + 1) * tileSize + side - 1) / side;
+            reduce(k, firstRow, lastRow, firstCol, lastCol);
+        }
+    }
+    previous = snapshot;
+}
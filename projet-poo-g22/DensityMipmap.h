@@ -0,0 +1,91 @@
+// components/DensityMipmap.h
+#ifndef DENSITYMIPMAP_H
+#define DENSITYMIPMAP_H
+
+#include "Snapshot.h"
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief Pyramide des nombres de cellules vivantes et d'obstacles par bloc.
+ *
+ * Le niveau k (1 à LEVELS) compte les cellules de chaque bloc de 2^k x 2^k
+ * cellules ; chaque niveau est calculé à partir du précédent, comme un
+ * quadtree complet. Vue de loin, une grille est ainsi affichée en lisant
+ * un bloc par pixel au lieu de toutes ses cellules.
+ *
+ * La pyramide est mise à jour à partir des instantanés successifs : seules
+ * les tuiles qui ne sont plus partagées avec l'instantané précédent sont
+ * recomptées, ainsi que les blocs qui les contiennent.
+ *
+ * Si les instantanés portent des compteurs par cellule (âge ou activité),
+ * leur somme par bloc est tenue à jour de la même façon.
+ */
+class DensityMipmap {
+public:
+    static const int LEVELS = 7; // Blocs de 2 x 2 à 128 x 128 cellules
+
+    /**
+     * @brief Construit une pyramide vide (0 x 0).
+     */
+    DensityMipmap();
+
+    /**
+     * @brief Met à jour les comptes à partir d'un instantané de la grille.
+     *
+     * Tout est recompté si les dimensions de la grille changent.
+     */
+    void update(const GridSnapshot& snapshot);
+
+    /**
+     * @brief Tuiles modifiées lors du dernier update() (indice ligne * colonnes de tuiles + colonne).
+     */
+    const std::vector<int>& getChangedTiles() const { return changedTiles; }
+
+    /**
+     * @brief Nombre de cellules vivantes d'un bloc du niveau level.
+     */
+    unsigned alive(int level, int row, int col) const { return levels[level - 1].alive[index(level, row, col)]; }
+
+    /**
+     * @brief Nombre d'obstacles d'un bloc du niveau level.
+     */
+    unsigned obstacles(int level, int row, int col) const { return levels[level - 1].obstacles[index(level, row, col)]; }
+
+    /**
+     * @brief Somme des compteurs d'un bloc du niveau level (0 si les instantanés n'en portent pas).
+     */
+    std::uint32_t counterSum(int level, int row, int col) const {
+        const Level& blocks = levels[level - 1];
+        return blocks.counters.empty() ? 0 : blocks.counters[index(level, row, col)];
+    }
+
+    // Getters
+    int getLevelRows(int level) const { return levels[level - 1].rows; }
+    int getLevelCols(int level) const { return levels[level - 1].cols; }
+    const GridSnapshot& getSnapshot() const { return previous; }
+
+private:
+    /**
+     * @brief Comptes d'un niveau, bloc par bloc, ligne par ligne.
+     */
+    struct Level {
+        int rows;
+        int cols;
+        std::vector<std::uint16_t> alive; // Au plus 128 x 128 = 16384 cellules par bloc
+        std::vector<std::uint16_t> obstacles;
+        std::vector<std::uint32_t> counters; // Au plus 16384 x 255 ; vide sans compteurs
+    };
+
+    Level levels[LEVELS];
+    GridSnapshot previous; // Dernier instantané compté
+    std::vector<int> changedTiles;
+
+    std::size_t index(int level, int row, int col) const {
+        return static_cast<std::size_t>(row) * levels[level - 1].cols + col;
+    }
+    void countTile(const GridSnapshot& snapshot, int tileRow, int tileCol);
+    void reduce(int level, int firstRow, int lastRow, int firstCol, int lastCol);
+};
+
+#endif // DENSITYMIPMAP_H
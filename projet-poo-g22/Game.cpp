@@ -2,62 +2,126 @@
 #include "Game.h"
 #include "Console.h"
 #include "Graphics.h"
+#include "Trace.h"
 #include <iostream>
+#include <fstream>
 #include <string>
 #include <memory>
+#include <cstdlib>
 
 using namespace std;
 
+namespace {
+
+// Vérifie si un fichier existe déjà, pour ne pas écraser une trajectoire sans confirmation
+bool fileExists(const string& filename) {
+    ifstream file(filename);
+    return file.good();
+}
+
+} // namespace
+
 void Game::run() {
     int rows = 25;
     int cols = 25;
-    int cellSize = 19;
     int maxIterations = 0;
-    int delay = 500; // Temps d'attente en millisecondes pour ralentir les itrations
+    int delay = 500; // Temps d'attente en millisecondes pour ralentir les itérations
     string mode;
     string filename;
 
-    cout << "Choisissez le mode (console insrez C et pour le mode graphique insrez G) : ";
+    cout << "Choisissez le mode (console insérez C et pour le mode graphique insérez G) : ";
     cin >> mode;
 
     if (mode != "C" && mode != "G") {
-        cout << "Mode invalide, veuillez redmarrer et choisir 'C' ou 'G'." << endl;
+        cout << "Mode invalide, veuillez redémarrer et choisir 'C' ou 'G'." << endl;
         return;
     }
 
-    cout << "Entrez le dlai entre chaque itration en millisecondes (par dfaut 500 ms) : ";
+    cout << "Entrez le délai entre chaque itération en millisecondes (par défaut 500 ms) : ";
     cin >> delay;
 
     Grid grid(rows, cols);
 
-    // Utilisation de std::unique_ptr pour la gestion de la mmoire
+    // Mesures de performance, écrites périodiquement au format Prometheus si JEU_DE_LA_VIE_METRICS désigne un fichier
+    const char* metricsFile = getenv("JEU_DE_LA_VIE_METRICS");
+    if (metricsFile && *metricsFile) {
+        shared_ptr<Metrics> metrics = make_shared<Metrics>();
+        metrics->startDump(metricsFile);
+        grid.setMetrics(metrics);
+    }
+
+    // Trace chronologique si JEU_DE_LA_VIE_TRACE désigne un fichier
+    const char* traceFile = getenv("JEU_DE_LA_VIE_TRACE");
+    if (traceFile && *traceFile) {
+        try {
+            Trace::start(traceFile);
+        }
+        catch (const runtime_error& e) {
+            cout << "Erreur : " << e.what() << endl;
+        }
+    }
+
+    // Utilisation de std::unique_ptr pour la gestion de la mémoire
     unique_ptr<SimulationInterface> interface;
 
     if (mode == "G") {
-        cout << "Entrez le nombre d'itrations (0 pour une simulation infinie) : ";
+        cout << "Entrez le nombre d'itérations (0 pour une simulation infinie) : ";
         cin >> maxIterations;
+        cin.ignore(); // Pour ignorer le caractère de nouvelle ligne restant dans le buffer
 
         interface = make_unique<GraphicsInterface>();
     }
     else if (mode == "C") {
-        cout << "Entrez le nom du fichier pour initialiser la grille (ou appuyez sur Entre pour crer une grille vide) : ";
-        cin.ignore(); // Pour ignorer le caractre de nouvelle ligne restant dans le buffer
+        cout << "Entrez le nom du fichier pour initialiser la grille (ou appuyez sur Entrée pour créer une grille vide) : ";
+        cin.ignore(); // Pour ignorer le caractère de nouvelle ligne restant dans le buffer
         getline(cin, filename);
 
         try {
-            if (!filename.empty()) {
-                grid.initializeFromInput(filename);
-            }
+            loadGridFile(grid, filename, false);
         }
         catch (const runtime_error& e) {
             cout << "Erreur : " << e.what() << endl;
             return;
         }
 
-        interface = make_unique<ConsoleInterface>();
+        string format;
+        cout << "Format du fichier de sortie (T pour la grille complète dans output.txt, D pour le journal delta output.delta) : ";
+        getline(cin, format);
+
+        interface = make_unique<ConsoleInterface>(format == "D" ? OutputWriter::DELTA : OutputWriter::TEXTE);
+    }
+
+    // Générations enregistrées sur disque sur demande : annulation sans limite et parcours avec les flèches
+    // gauche et droite (une trajectoire chargée en mode console est prolongée). Par défaut, l'historique reste en mémoire.
+    if (interface && !grid.hasTrajectory()) {
+        string trajectoryFile;
+        cout << "Fichier de trajectoire .golt (ou appuyez sur Entrée pour garder l'historique en mémoire) : ";
+        getline(cin, trajectoryFile);
+
+        if (!trajectoryFile.empty() && fileExists(trajectoryFile)) {
+            string answer;
+            cout << "Le fichier " << trajectoryFile << " existe déjà, l'écraser ? (O/N) : ";
+            getline(cin, answer);
+            if (answer != "O" && answer != "o") {
+                cout << "Trajectoire non enregistrée, l'historique reste en mémoire." << endl;
+                trajectoryFile.clear();
+            }
+        }
+
+        if (!trajectoryFile.empty()) {
+            try {
+                grid.recordTrajectory(trajectoryFile);
+            }
+            catch (const runtime_error& e) {
+                cout << "Erreur : " << e.what() << endl;
+            }
+        }
     }
 
     if (interface) {
         interface->run(grid, delay, maxIterations);
     }
+    if (!Trace::stop()) {
+        cout << "Erreur d'écriture de la trace." << endl;
+    }
 }
@@ -5,20 +5,42 @@
 #include "Grid.h"
 #include "SimulationInterface.h"
 #include <memory> // Pour std::unique_ptr
+#include <string>
 
 /**
- * @brief Classe principale contrlant le flux de l'application.
+ * @brief Classe principale contrôlant le flux de l'application.
  *
- * Cette classe gre la slection du mode d'interface (console ou graphique),
- * l'initialisation de la grille, et l'excution de la simulation via
- * l'interface slectionne.
+ * Cette classe gère la sélection du mode d'interface (console ou graphique),
+ * l'initialisation de la grille, et l'exécution de la simulation via
+ * l'interface sélectionnée. Le mode sans affichage (GameHeadless.cpp) ne
+ * dépend pas de SFML.
  */
 class Game {
 public:
     /**
-     * @brief Excute le jeu.
+     * @brief Exécute le jeu.
      */
     void run();
+
+    /**
+     * @brief Exécute le jeu sans affichage ni saisie, selon la ligne de commande.
+     *
+     * @param argc Nombre d'arguments.
+     * @param argv Arguments (voir HeadlessOptions::usage).
+     * @return int Code de sortie (0 en cas de succès).
+     */
+    int runHeadless(int argc, char* argv[]);
+
+private:
+    /**
+     * @brief Charge un fichier dans la grille selon son extension (.rle, .golb, .mc, .delta, .golt ou texte).
+     *
+     * @param grid Grille à initialiser.
+     * @param filename Nom du fichier (vide : la grille est laissée telle quelle).
+     * @param keepDimensions Conserver les dimensions de la grille pour un fichier texte.
+     * @throws std::runtime_error Si le fichier ne peut pas être lu.
+     */
+    static void loadGridFile(Grid& grid, const std::string& filename, bool keepDimensions);
 };
 
 #endif // GAME_H
@@ -0,0 +1,103 @@
+// services/GameHeadless.cpp
+#include "Game.h"
+#include "Headless.h"
+#include "Log.h"
+#include "Trace.h"
+#include <iostream>
+#include <string>
+#include <random>
+
+using namespace std;
+
+namespace {
+
+bool hasExtension(const string& filename, const string& extension) {
+    return filename.size() > extension.size() &&
+           filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+} // namespace
+
+// Charge un fichier dans la grille selon son extension
+void Game::loadGridFile(Grid& grid, const string& filename, bool keepDimensions) {
+    TRACE_SPAN("Game::loadGridFile");
+    if (hasExtension(filename, ".rle")) {
+        grid.initializeFromRLE(filename); // Motif au format RLE
+    }
+    else if (hasExtension(filename, ".golb")) {
+        grid.loadBinary(filename); // Instantané binaire
+    }
+    else if (hasExtension(filename, ".mc")) {
+        grid.initializeFromMacrocell(filename); // Motif Macrocell (arbre quaternaire)
+    }
+    else if (hasExtension(filename, ".delta")) {
+        grid.loadDeltaLog(filename); // Dernière génération d'un journal delta
+    }
+    else if (hasExtension(filename, ".golt")) {
+        grid.resumeTrajectory(filename); // Trajectoire reprise et prolongée
+    }
+    else if (!filename.empty() && keepDimensions) {
+        grid.initializeFromInput(filename); // Dimensions imposées
+    }
+    else if (!filename.empty()) {
+        grid.loadFromInput(filename); // Dimensions déduites du fichier
+    }
+}
+
+int Game::runHeadless(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        string option = argv[i];
+        if (option == "-h" || option == "--help") {
+            cout << HeadlessOptions::usage(argv[0]);
+            return 0;
+        }
+    }
+
+    try {
+        HeadlessOptions options = HeadlessOptions::parse(argc, argv);
+        if (!options.logLevel.empty()) {
+            Log::setLevel(Log::parseLevel(options.logLevel));
+        }
+        if (!options.trace.empty()) {
+            Trace::start(options.trace); // Le chargement de la grille est aussi tracé
+        }
+        bool keepDimensions = options.rows > 0 || options.cols > 0;
+        Grid grid(options.rows > 0 ? options.rows : 25, options.cols > 0 ? options.cols : 25);
+        loadGridFile(grid, options.input, keepDimensions);
+
+        if (options.density > 0.0) {
+            // Remplissage aléatoire reproductible (graine fixée)
+            mt19937 random(options.seed);
+            bernoulli_distribution alive(options.density);
+            Pattern pattern;
+            pattern.alive = BitPlane(grid.getRows(), grid.getCols());
+            pattern.rule = grid.getRule();
+            for (int i = 0; i < grid.getRows(); ++i) {
+                for (int j = 0; j < grid.getCols(); ++j) {
+                    if (alive(random)) pattern.alive.set(i, j);
+                }
+            }
+            grid.loadPattern(pattern);
+        }
+        if (!options.rule.empty()) {
+            grid.setRule(Rule::parse(options.rule));
+        }
+        if (options.toric) {
+            grid.setToric(true);
+        }
+        grid.setThreads(options.threads);
+
+        HeadlessInterface headless(options);
+        headless.run(grid, 0, 0);
+        if (!Trace::stop()) {
+            throw runtime_error("Erreur d'écriture de la trace.");
+        }
+    }
+    catch (const exception& e) {
+        Log::flush();
+        cerr << "Erreur : " << e.what() << endl;
+        return 1;
+    }
+    Log::flush();
+    return 0;
+}
@@ -1,15 +1,65 @@
 // interfaces/Graphics.cpp
 #include "Graphics.h"
+#include "GridRenderer.h"
+#include "TextureRenderer.h"
+#include "Camera.h"
+#include "SimulationThread.h"
+#include "PatternPalette.h"
+#include "BrushStroke.h"
+#include "Trace.h"
 #include <iostream>
-#include <thread>
+#include <memory>
+#include <algorithm>
+#include <cstdio>
+#include <cmath>
 #include <chrono>
 
+namespace {
+
+const long long TEXTURE_THRESHOLD = 256 * 256; // Au-delà, la grille est affichée sous forme de texture
+const double MIN_RATE = 0.25; // Vitesses réglables au clavier, en générations par seconde
+const double MAX_RATE = 4096;
+const double MAX_SPEED_FALLBACK = 60; // Vitesse retenue en quittant la vitesse maximale
+const double ZOOM_STEP = 1.25; // Facteur de zoom par cran de molette
+
+} // namespace
+
 void GraphicsInterface::run(Grid& grid, int delay, int maxIterations) {
     int rows = grid.getRows();
     int cols = grid.getCols();
-    int cellSize = 19; // Taille des cellules (doit correspondre  celle utilise dans Grid)
+    // Taille des cellules en pixels, réduite pour que la grille tienne dans l'écran (vue d'ensemble)
+    sf::VideoMode desktop = sf::VideoMode::getDesktopMode();
+    int maxWidth = std::max(1, static_cast<int>(desktop.width) * 9 / 10);
+    int maxHeight = std::max(1, static_cast<int>(desktop.height) * 9 / 10 - 100);
+    int cellSize = std::min(19, std::min(maxWidth / std::max(1, cols), maxHeight / std::max(1, rows)));
+    int boardWidth = cols * cellSize;
+    int boardHeight = rows * cellSize;
+    if (cellSize == 0) {
+        // Moins d'un pixel par cellule : la grille est réduite en conservant ses proportions
+        double factor = std::min(static_cast<double>(maxWidth) / cols, static_cast<double>(maxHeight) / rows);
+        boardWidth = std::max(1, static_cast<int>(cols * factor));
+        boardHeight = std::max(1, static_cast<int>(rows * factor));
+    }
 
-    sf::RenderWindow window(sf::VideoMode(cols * cellSize, rows * cellSize + 100), "Jeu de la Vie");
+    // Petites grilles : un quadrilatère par cellule ; grandes grilles : texture de la partie visible
+    std::unique_ptr<GridRenderer> quads;
+    std::unique_ptr<TextureRenderer> texture;
+    if (cellSize < 4 || static_cast<long long>(rows) * cols > TEXTURE_THRESHOLD) {
+        texture.reset(new TextureRenderer());
+    }
+    else {
+        quads.reset(new GridRenderer(cellSize));
+    }
+
+    // Zoom (molette), déplacement (bouton du milieu), vue d'ensemble (touche Début)
+    Camera camera(boardWidth, boardHeight, rows, cols, 19);
+    bool panning = false;
+    sf::Vector2i panOrigin;
+
+    sf::RenderWindow window(sf::VideoMode(boardWidth, boardHeight + 100), "Jeu de la Vie");
+    // La grille est dessinée dans sa zone, sans déborder sur les boutons
+    sf::View boardView(sf::FloatRect(0, 0, static_cast<float>(boardWidth), static_cast<float>(boardHeight)));
+    boardView.setViewport(sf::FloatRect(0, 0, 1, static_cast<float>(boardHeight) / (boardHeight + 100)));
 
     sf::Font font;
     if (!font.loadFromFile("arial.ttf")) {
@@ -17,95 +67,278 @@ void GraphicsInterface::run(Grid& grid, int delay, int maxIterations) {
         return;
     }
 
-    Button startButton(10, rows * cellSize + 10, 150, 40, font, "Dmarrer", sf::Color::Green);
-    Button stopButton(170, rows * cellSize + 10, 150, 40, font, "Arrter", sf::Color::Red);
-    Button undoButton(330, rows * cellSize + 10, 150, 40, font, "Annuler", sf::Color::Blue);
+    Button startButton(10, boardHeight + 10, 150, 40, font, "Démarrer", sf::Color::Green);
+    Button stopButton(170, boardHeight + 10, 150, 40, font, "Arrêter", sf::Color::Red);
+    Button undoButton(330, boardHeight + 10, 150, 40, font, "Annuler", sf::Color::Blue);
 
-    bool simulationRunning = false;
-    CellState currentState = VIVANT; // Commencer avec l'tat 'VIVANT'
-    int iterationsCount = 0;
+    CellState currentState = VIVANT; // Commencer avec l'état 'VIVANT'
 
-    while (window.isOpen()) {
-        sf::Event event;
-        while (window.pollEvent(event)) {
-            if (event.type == sf::Event::Closed) {
-                window.close();
-            }
-
-            if (event.type == sf::Event::MouseButtonPressed) {
-                if (event.mouseButton.button == sf::Mouse::Left) {
-                    if (startButton.isClicked(event.mouseButton.x, event.mouseButton.y)) {
-                        simulationRunning = true;   // Dmarrer la simulation
-                        startButton.setColor(sf::Color::Red);
-                        stopButton.setColor(sf::Color::Green);
-                    }
-                    if (stopButton.isClicked(event.mouseButton.x, event.mouseButton.y)) {
-                        simulationRunning = false;  // Arrter la simulation
-                        startButton.setColor(sf::Color::Green);
-                        stopButton.setColor(sf::Color::Red);
-                    }
-                    if (undoButton.isClicked(event.mouseButton.x, event.mouseButton.y)) {
-                        simulationRunning = false;  // Arrter la simulation
-                        startButton.setColor(sf::Color::Green);  // Rinitialiser l'tat des boutons
-                        stopButton.setColor(sf::Color::Red);
-                        grid.undo();  // Restaurer l'tat prcdent de la grille
-                    }
-                    grid.toggleCell(event.mouseButton.x, event.mouseButton.y, cellSize, currentState); // Basculer l'tat de la cellule
-                }
-                else if (event.mouseButton.button == sf::Mouse::Right) {
-                    grid.toggleCell(event.mouseButton.x, event.mouseButton.y, cellSize, OBSTACLE); // Ajouter un obstacle
-                }
-            }
+    // Outil d'édition : pinceau (tracé à la souris) ou construction de la palette
+    int selectedMotif = -1; // -1 : pinceau
+    int brushRadius = 0;
+    int rotation = 0; // Quarts de tour appliqués aux constructions
+    bool mirrored = false;
+    BitPlane brush = PatternPalette::brush(brushRadius);
+    BrushStroke stroke;
+    CellState strokeState = VIVANT;
+    bool painting = false;
+    GridSnapshot::Counters counters = GridSnapshot::AUCUN; // Couleurs selon l'état, l'âge ou l'activité
+
+    // Cellule sous la souris ; false hors de la grille
+    auto cellAt = [&](int x, int y, int& row, int& col) {
+        if (x < 0 || x >= boardWidth || y < 0 || y >= boardHeight) {
+            return false;
+        }
+        double r = std::floor(camera.toRow(y));
+        double c = std::floor(camera.toColumn(x));
+        if (r < 0 || r >= rows || c < 0 || c >= cols) {
+            return false;
+        }
+        row = static_cast<int>(r);
+        col = static_cast<int>(c);
+        return true;
+    };
 
-            if (event.type == sf::Event::KeyPressed) {
-                if (event.key.code == sf::Keyboard::V) {
-                    currentState = VIVANT;
+    // Envoie un motif à appliquer (une seule modification de la grille)
+    auto sendShape = [](SimulationThread& simulation, const std::shared_ptr<const BitPlane>& shape, int top, int left, CellState state) {
+        SimulationThread::Command command = { SimulationThread::Command::DESSINER, top, left, state, 0, shape };
+        simulation.send(command);
+    };
+
+    // Regroupe le tracé de l'image en cours en une seule modification
+    auto flushStroke = [&](SimulationThread& simulation) {
+        std::shared_ptr<BitPlane> plane = std::make_shared<BitPlane>();
+        int top = 0, left = 0;
+        if (stroke.take(brush, *plane, top, left)) {
+            sendShape(simulation, plane, top, left, strokeState);
+        }
+    };
+
+    // Pose le pinceau ou la construction sélectionnée sous la souris
+    auto press = [&](SimulationThread& simulation, int x, int y, CellState state) {
+        int row = 0, col = 0;
+        if (!cellAt(x, y, row, col)) {
+            return;
+        }
+        if (selectedMotif >= 0 && state != OBSTACLE) {
+            // Construction centrée sous la souris, orientée au moment de la pose
+            std::shared_ptr<const BitPlane> shape = std::make_shared<BitPlane>(
+                PatternPalette::pattern(static_cast<PatternPalette::Motif>(selectedMotif)).transformed(rotation, mirrored));
+            sendShape(simulation, shape, row - shape->getRows() / 2, col - shape->getCols() / 2, state);
+            return;
+        }
+        if (painting && state != strokeState) {
+            flushStroke(simulation); // Un tracé par état
+        }
+        stroke.end();
+        strokeState = state;
+        painting = true;
+        stroke.add(row, col);
+    };
+
+    // La simulation tourne sur son propre thread ; cette boucle ne fait qu'afficher la dernière image publiée
+    std::shared_ptr<Metrics> metrics = grid.getMetrics(); // Lu avant que le thread de simulation ne prenne la grille
+    SimulationThread simulation(grid, delay, maxIterations);
+    Trace::setThreadName("GraphicsInterface");
+    window.setVerticalSyncEnabled(true); // Pendant la simulation, au plus une image par rafraîchissement de l'écran
+
+    // Traite un événement ; retourne true si l'affichage doit être redessiné
+    auto handleEvent = [&](const sf::Event& event) {
+        if (event.type == sf::Event::Closed) {
+            window.close();
+        }
+
+        if (event.type == sf::Event::MouseButtonPressed) {
+            if (event.mouseButton.button == sf::Mouse::Left) {
+                if (startButton.isClicked(event.mouseButton.x, event.mouseButton.y)) {
+                    simulation.setRunning(true);   // Démarrer la simulation
                 }
-                else if (event.key.code == sf::Keyboard::D) {
-                    currentState = VIDE;
+                if (stopButton.isClicked(event.mouseButton.x, event.mouseButton.y)) {
+                    simulation.setRunning(false);  // Arrêter la simulation
                 }
-                else if (event.key.code == sf::Keyboard::O) {
-                    currentState = OBSTACLE;
+                if (undoButton.isClicked(event.mouseButton.x, event.mouseButton.y)) {
+                    SimulationThread::Command command = { SimulationThread::Command::ANNULER, 0, 0, VIDE, 0, nullptr };
+                    simulation.send(command); // Arrête la simulation et restaure l'état précédent
                 }
+                press(simulation, event.mouseButton.x, event.mouseButton.y, currentState); // Peindre ou poser une construction
+            }
+            else if (event.mouseButton.button == sf::Mouse::Right) {
+                press(simulation, event.mouseButton.x, event.mouseButton.y, OBSTACLE); // Peindre des obstacles
+            }
+            else if (event.mouseButton.button == sf::Mouse::Middle) {
+                panning = true;
+                panOrigin = sf::Vector2i(event.mouseButton.x, event.mouseButton.y);
+            }
+        }
+
+        if (event.type == sf::Event::MouseButtonReleased) {
+            if (event.mouseButton.button == sf::Mouse::Middle) {
+                panning = false;
+            }
+            else {
+                painting = false;
+                stroke.end(); // Lever le pinceau
             }
         }
 
-        if (simulationRunning) {
-            grid.update();
-            iterationsCount++;
+        if (event.type == sf::Event::MouseMoved && painting) {
+            // Continuer le tracé (appliqué une fois par image)
+            int row = 0, col = 0;
+            if (cellAt(event.mouseMove.x, event.mouseMove.y, row, col)) {
+                stroke.add(row, col);
+            }
+            else {
+                stroke.end();
+            }
+        }
+
+        if (event.type == sf::Event::MouseMoved && panning) {
+            // Déplacer la vue avec la souris
+            camera.pan(panOrigin.x - event.mouseMove.x, panOrigin.y - event.mouseMove.y);
+            panOrigin = sf::Vector2i(event.mouseMove.x, event.mouseMove.y);
+        }
 
-            // Vrification si la simulation doit tre arrte
-            if (maxIterations > 0 && iterationsCount >= maxIterations) {
-                // Arrter la simulation aprs le nombre d'itrations maximum
-                simulationRunning = false;
-                startButton.setColor(sf::Color::Green);
-                stopButton.setColor(sf::Color::Red);
+        if (event.type == sf::Event::MouseWheelScrolled && event.mouseWheelScroll.y < boardHeight) {
+            // Zoomer autour du pointeur
+            double factor = std::pow(ZOOM_STEP, event.mouseWheelScroll.delta);
+            camera.zoom(factor, event.mouseWheelScroll.x, event.mouseWheelScroll.y);
+        }
+
+        if (event.type == sf::Event::KeyPressed) {
+            if (event.key.code == sf::Keyboard::V) {
+                currentState = VIVANT;
+            }
+            else if (event.key.code == sf::Keyboard::D) {
+                currentState = VIDE;
+            }
+            else if (event.key.code == sf::Keyboard::O) {
+                currentState = OBSTACLE;
+            }
+            else if (event.key.code == sf::Keyboard::Up || event.key.code == sf::Keyboard::Down) {
+                // Doubler ou diviser par deux la vitesse (depuis la vitesse maximale : 60 générations/s)
+                double rate = simulation.getRate() > 0 ? simulation.getRate() : MAX_SPEED_FALLBACK;
+                rate = event.key.code == sf::Keyboard::Up ? rate * 2 : rate / 2;
+                simulation.setRate(std::min(std::max(rate, MIN_RATE), MAX_RATE));
+            }
+            else if (event.key.code == sf::Keyboard::Home) {
+                camera.reset(); // Revenir à la vue d'ensemble
+            }
+            else if (event.key.code == sf::Keyboard::M) {
+                // Basculer la vitesse maximale
+                simulation.setRate(simulation.getRate() > 0 ? 0.0 : MAX_SPEED_FALLBACK);
+            }
+            else if (event.key.code == sf::Keyboard::B) {
+                selectedMotif = -1; // Revenir au pinceau
+            }
+            else if (event.key.code == sf::Keyboard::P) {
+                // Construction suivante de la palette, puis retour au pinceau
+                selectedMotif = selectedMotif + 1 < PatternPalette::MOTIFS ? selectedMotif + 1 : -1;
+            }
+            else if (event.key.code == sf::Keyboard::R) {
+                rotation = (rotation + 1) % 4; // Quart de tour horaire
+            }
+            else if (event.key.code == sf::Keyboard::F) {
+                mirrored = !mirrored; // Miroir horizontal
+            }
+            else if (event.key.code == sf::Keyboard::Add || event.key.code == sf::Keyboard::Subtract) {
+                // Agrandir ou réduire le pinceau
+                int radius = brushRadius + (event.key.code == sf::Keyboard::Add ? 1 : -1);
+                brushRadius = std::min(std::max(radius, 0), PatternPalette::MAX_BRUSH_RADIUS);
+                brush = PatternPalette::brush(brushRadius);
             }
-            else if (grid.hasStableState()) {
-                // Arrter la simulation si la grille est stable
-                simulationRunning = false;
-                startButton.setColor(sf::Color::Green);
-                stopButton.setColor(sf::Color::Red);
-                std::cout << "La grille a atteint un tat stable. Fin de la simulation." << std::endl;
+            else if (event.key.code == sf::Keyboard::H) {
+                // Couleurs suivantes : état, âge, activité (compteurs calculés par la simulation)
+                counters = static_cast<GridSnapshot::Counters>((counters + 1) % 3);
+                SimulationThread::Command command = { SimulationThread::Command::COMPTER, 0, 0, VIDE, counters, nullptr };
+                simulation.send(command);
             }
+            else if (event.key.code == sf::Keyboard::Left || event.key.code == sf::Keyboard::Right) {
+                // Parcourir la trajectoire enregistrée (ignoré pendant la simulation)
+                long long offset = event.key.code == sf::Keyboard::Left ? -1 : 1;
+                SimulationThread::Command command = { SimulationThread::Command::ALLER_A, 0, 0, VIDE, offset, nullptr };
+                simulation.send(command);
+            }
+        }
+        // Un déplacement de la souris sans glisser ne change rien à l'affichage
+        return event.type != sf::Event::MouseMoved || panning || painting;
+    };
+
+    sf::Text iterationsText;
+    iterationsText.setFont(font);
+    iterationsText.setCharacterSize(18);
+    iterationsText.setFillColor(sf::Color::Black);
+    iterationsText.setPosition(10, boardHeight + 50);
+
+    bool redraw = true;
+    while (window.isOpen()) {
+        sf::Event event;
+        bool settled = simulation.isSettled(); // Lu avant poll() : une image publiée avant la pause est vue
+        bool changed = simulation.poll();
+        if (settled && !changed && !redraw) {
+            // En pause et sans demande en cours : attendre un événement, sans calcul ni affichage
+            if (window.waitEvent(event)) {
+                redraw = handleEvent(event);
+            }
+            continue;
+        }
+        while (window.pollEvent(event)) {
+            redraw = handleEvent(event) || redraw;
         }
+        flushStroke(simulation);
+        redraw = false;
+
+        // Couleur des boutons selon l'état de la simulation (qui peut s'arrêter seule)
+        bool simulationRunning = simulation.isRunning();
+        startButton.setColor(simulationRunning ? sf::Color::Red : sf::Color::Green);
+        stopButton.setColor(simulationRunning ? sf::Color::Green : sf::Color::Red);
 
+        // Seules les cellules (ou lignes de pixels visibles) modifiées sont mises à jour
+        TRACE_SPAN("GraphicsInterface::frame");
+        std::chrono::steady_clock::time_point rendered = std::chrono::steady_clock::now();
         window.clear();
-        grid.draw(window, cellSize);
+        window.setView(boardView);
+        if (texture) {
+            texture->update(simulation.frame().snapshot, camera);
+            window.draw(*texture);
+        }
+        else {
+            quads->update(simulation.frame().snapshot);
+            // Les quadrilatères sont placés à cellSize pixels d'écart : la caméra les met à l'échelle
+            sf::RenderStates states;
+            float scale = static_cast<float>(camera.getCellSize() / cellSize);
+            states.transform.scale(scale, scale);
+            states.transform.translate(static_cast<float>(-camera.getLeft() * cellSize), static_cast<float>(-camera.getTop() * cellSize));
+            window.draw(*quads, states);
+        }
+        window.setView(window.getDefaultView());
         startButton.draw(window);
         stopButton.draw(window);
         undoButton.draw(window);
 
-        // Affichage du nombre d'itrations effectues
-        sf::Text iterationsText;
-        iterationsText.setFont(font);
-        iterationsText.setCharacterSize(18);
-        iterationsText.setFillColor(sf::Color::Black);
-        iterationsText.setPosition(10, rows * cellSize + 50);
-        iterationsText.setString("Iterations: " + std::to_string(iterationsCount));
+        // Affichage du nombre d'itérations effectuées
+        double rate = simulation.getRate();
+        char speed[32];
+        if (rate > 0) {
+            snprintf(speed, sizeof(speed), "%g gen/s", rate);
+        }
+        else {
+            snprintf(speed, sizeof(speed), "max");
+        }
+        // Outil d'édition courant
+        std::string tool = "Pinceau (rayon " + std::to_string(brushRadius) + ")";
+        if (selectedMotif >= 0) {
+            tool = PatternPalette::name(static_cast<PatternPalette::Motif>(selectedMotif));
+            tool += " (" + std::to_string(rotation * 90) + (mirrored ? "°, miroir)" : "°)");
+        }
+        static const char* const COLORINGS[3] = { "état", "âge", "activité" };
+        iterationsText.setString("Iterations: " + std::to_string(simulation.frame().iterations) + "   Vitesse: " + speed + "   Outil: " + tool +
+                                 "   Couleurs: " + COLORINGS[counters]);
         window.draw(iterationsText);
 
+        if (metrics) {
+            // Mesuré avant display(), qui attend la synchronisation verticale
+            metrics->recordTime(Metrics::RENDU, std::chrono::duration<double>(std::chrono::steady_clock::now() - rendered).count());
+        }
         window.display();
-        std::this_thread::sleep_for(std::chrono::milliseconds(delay));
     }
 }
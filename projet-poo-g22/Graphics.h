@@ -11,17 +11,17 @@
 /**
  * @brief Interface graphique pour la simulation utilisant SFML.
  *
- * Cette classe gre l'affichage de la grille, les boutons interactifs,
- * et les interactions utilisateur via une fentre graphique.
+ * Cette classe gère l'affichage de la grille, les boutons interactifs,
+ * et les interactions utilisateur via une fenêtre graphique.
  */
 class GraphicsInterface : public SimulationInterface {
 public:
     /**
-     * @brief Excute la simulation en mode graphique.
+     * @brief Exécute la simulation en mode graphique.
      *
-     * @param grid Rfrence vers la grille de simulation.
-     * @param delay Dlai entre chaque itration en millisecondes.
-     * @param maxIterations Nombre maximal d'itrations (0 pour infini).
+     * @param grid Référence vers la grille de simulation.
+     * @param delay Délai entre chaque itération en millisecondes.
+     * @param maxIterations Nombre maximal d'itérations (0 pour infini).
      */
     void run(Grid& grid, int delay, int maxIterations) override;
 };
@@ -1,5 +1,11 @@
 //Grid.cpp
 #include "Grid.h"
+#include "TextGridReader.h"
+#include "BinarySnapshot.h"
+#include "DeltaLogReader.h"
+#include "Macrocell.h"
+#include "Log.h"
+#include "Trace.h"
 #include <iostream>
 // components/Grid.cpp
 
@@ -8,46 +14,246 @@
 #include <stdexcept>
 #include <thread>
 #include <chrono>
+#include <algorithm>
 
 using namespace std;
 
+namespace {
+
+// Octets des tuiles de snapshot qui ne sont pas partagées (même position) avec neighbor
+size_t ownTileBytes(const GridSnapshot& snapshot, const GridSnapshot* neighbor) {
+    if (neighbor && (neighbor->getRows() != snapshot.getRows() || neighbor->getCols() != snapshot.getCols())) {
+        neighbor = nullptr;
+    }
+    const GridSnapshot::TilePtr& empty = GridSnapshot::emptyTile();
+    size_t tiles = 0;
+    for (int tr = 0; tr < snapshot.getTileRows(); ++tr) {
+        for (int tc = 0; tc < snapshot.getTileCols(); ++tc) {
+            const GridSnapshot::TilePtr& tile = snapshot.getTile(tr, tc);
+            const GridSnapshot::TilePtr& counterTile = snapshot.getCounterTile(tr, tc);
+            tiles += tile != empty && (!neighbor || tile != neighbor->getTile(tr, tc));
+            tiles += counterTile != empty && (!neighbor || counterTile != neighbor->getCounterTile(tr, tc));
+        }
+    }
+    return tiles * sizeof(GridSnapshot::Tile);
+}
+
+} // namespace
+
 // Constructeur de la grille
-Grid::Grid(int r, int c) : rows(r), cols(c) {
-    cells.resize(rows, vector<CellState>(cols, VIDE));
+Grid::Grid(int r, int c)
+    : historyLimit(0), heldBytes(0), current(r, c), counterMode(GridSnapshot::AUCUN), generation(0), toric(false), rows(r), cols(c) {
+    cells.assign(static_cast<size_t>(rows) * cols, VIDE);
+    dirtyTiles.assign(static_cast<size_t>(current.getTileRows()) * current.getTileCols(), 0);
+    counterDirtyTiles.assign(dirtyTiles.size(), 0);
     // Vider la pile d'historique lors de la construction
-    while (!history.empty()) {
-        history.pop();
+    history.clear();
+}
+
+// Construit une grille à partir d'un instantané
+Grid::Grid(const GridSnapshot& snapshot)
+    : historyLimit(0), heldBytes(0), current(snapshot), counterMode(GridSnapshot::AUCUN), generation(0), toric(false),
+      rows(snapshot.getRows()), cols(snapshot.getCols()) {
+    snapshot.restore(cells);
+    dirtyTiles.assign(static_cast<size_t>(current.getTileRows()) * current.getTileCols(), 0);
+    counterDirtyTiles.assign(dirtyTiles.size(), 0);
+    if (current.getCounters() != GridSnapshot::AUCUN) {
+        current.setCounters(GridSnapshot::AUCUN); // Compteurs désactivés par défaut
     }
 }
 
-// Initialise la grille  partir d'un fichier
+// Initialise la grille à partir d'un fichier
 void Grid::initializeFromInput(const string& filename) {
-    ifstream file(filename);
-    if (!file.is_open()) {
-        throw runtime_error("Impossible d'ouvrir le fichier.");
-    }
+    TextGridReader reader(filename); // Projection du fichier, exception s'il est introuvable
 
     // Vider la pile d'historique avant d'initialiser
-    while (!history.empty()) {
-        history.pop();
+    resetHistory();
+    generation = 0;
+
+    // Les jetons sont écrits directement dans les cellules
+    reader.read(cells.data(), cells.size());
+
+    if (trajectory) {
+        trajectory->append(generation, snapshot());
+    }
+}
+
+// Initialise la grille à partir d'un fichier en adoptant ses dimensions
+void Grid::loadFromInput(const string& filename) {
+    TextGridReader reader(filename);
+    int fileRows;
+    int fileCols;
+    reader.dimensions(fileRows, fileCols);
+    if (fileRows == 0 || fileCols == 0) {
+        throw runtime_error("Aucune cellule dans le fichier.");
+    }
+
+    resize(fileRows, fileCols);
+    reader.read(cells.data(), cells.size());
+    generation = 0;
+
+    if (trajectory) {
+        trajectory->append(generation, snapshot());
+    }
+}
+
+// Initialise la grille à partir d'un fichier RLE
+void Grid::initializeFromRLE(const string& filename) {
+    loadPattern(RLE::read(filename));
+}
+
+// Enregistre la grille au format RLE
+void Grid::saveRLE(const string& filename) const {
+    RLE::write(filename, toPattern());
+}
+
+// Initialise la grille à partir de la région occupée d'un motif Macrocell
+void Grid::initializeFromMacrocell(const string& filename) {
+    const long long MAX_CELLS = 1LL << 28; // Limite de la conversion en grille à plat
+    Pattern pattern;
+    pattern.rule = rule;
+    Quadtree tree = Macrocell::read(filename, pattern.rule);
+
+    long long top = 0, left = 0, bottom = -1, right = -1;
+    tree.bounds(top, left, bottom, right);
+    long long height = bottom - top + 1;
+    long long width = right - left + 1;
+    if (height > MAX_CELLS || width > MAX_CELLS || height * width > MAX_CELLS) {
+        throw runtime_error("Motif Macrocell trop grand pour une grille à plat.");
+    }
+    pattern.alive = BitPlane(static_cast<int>(height), static_cast<int>(width));
+    pattern.obstacles = BitPlane(static_cast<int>(height), static_cast<int>(width));
+    tree.extract(top, left, pattern.alive, pattern.obstacles);
+    loadPattern(pattern);
+}
+
+// Enregistre la grille au format Macrocell
+void Grid::saveMacrocell(const string& filename) const {
+    Pattern pattern = toPattern();
+    Macrocell::write(filename, Quadtree::fromPattern(pattern.alive, pattern.obstacles), rule);
+}
+
+// Remplace le contenu de la grille par un motif centré
+void Grid::loadPattern(const Pattern& pattern) {
+    int patternRows = pattern.alive.getRows();
+    int patternCols = pattern.alive.getCols();
+    resize(max(rows, patternRows), max(cols, patternCols));
+    fill(cells.begin(), cells.end(), VIDE);
+
+    int top = (rows - patternRows) / 2;
+    int left = (cols - patternCols) / 2;
+    bool hasObstacles = pattern.obstacles.getRows() == patternRows && pattern.obstacles.getCols() == patternCols;
+    for (int i = 0; i < patternRows; ++i) {
+        const uint64_t* alive = pattern.alive.rowData(i);
+        const uint64_t* obstacles = hasObstacles ? pattern.obstacles.rowData(i) : nullptr;
+        CellState* row = &cells[static_cast<size_t>(top + i) * cols + left];
+        for (int w = 0; w < pattern.alive.getWordsPerRow(); ++w) {
+            uint64_t any = alive[w] | (obstacles ? obstacles[w] : 0);
+            if (!any) continue; // Mot entièrement vide
+            int last = min(64, patternCols - w * 64);
+            for (int b = 0; b < last; ++b) {
+                if ((obstacles && ((obstacles[w] >> b) & 1))) row[w * 64 + b] = OBSTACLE;
+                else if ((alive[w] >> b) & 1) row[w * 64 + b] = VIVANT;
+            }
+        }
+    }
+    rule = pattern.rule;
+    generation = 0;
+
+    resetHistory();
+    if (trajectory) {
+        trajectory->append(generation, snapshot());
     }
+}
 
+// Retourne le contenu de la grille sous forme de plans de bits
+Pattern Grid::toPattern() const {
+    Pattern pattern;
+    pattern.alive = BitPlane(rows, cols);
+    pattern.obstacles = BitPlane(rows, cols);
+    pattern.rule = rule;
     for (int i = 0; i < rows; ++i) {
+        const CellState* row = &cells[static_cast<size_t>(i) * cols];
         for (int j = 0; j < cols; ++j) {
-            string token;
-            file >> token;
-            if (token == "1") {
-                cells[i][j] = VIVANT;
-            }
-            else if (token == "X" || token == "x") {
-                cells[i][j] = OBSTACLE;
-            }
-            else {
-                cells[i][j] = VIDE;
+            if (row[j] == VIVANT) pattern.alive.set(i, j);
+            else if (row[j] == OBSTACLE) pattern.obstacles.set(i, j);
+        }
+    }
+    return pattern;
+}
+
+// Enregistre la grille au format binaire
+void Grid::saveBinary(const string& filename, bool compress) const {
+    BinarySnapshot::save(filename, toPattern(), toric, generation, compress);
+}
+
+// Charge un instantané binaire (dimensions, règle, topologie et génération comprises)
+void Grid::loadBinary(const string& filename) {
+    BinarySnapshot snapshot(filename);
+    resize(snapshot.getRows(), snapshot.getCols());
+    for (int i = 0; i < rows; ++i) {
+        // Lignes lues directement dans le fichier projeté
+        const uint64_t* alive = snapshot.aliveRow(i);
+        const uint64_t* obstacles = snapshot.obstacleRow(i);
+        CellState* row = &cells[static_cast<size_t>(i) * cols];
+        for (int w = 0; w < snapshot.getWordsPerRow(); ++w) {
+            if (!(alive[w] | obstacles[w])) continue;
+            int last = min(64, cols - w * 64);
+            for (int b = 0; b < last; ++b) {
+                if ((obstacles[w] >> b) & 1) row[w * 64 + b] = OBSTACLE;
+                else if ((alive[w] >> b) & 1) row[w * 64 + b] = VIVANT;
             }
         }
     }
-    file.close();
+    rule = snapshot.getRule();
+    toric = snapshot.isToric();
+    generation = snapshot.getGeneration();
+
+    if (trajectory) {
+        trajectory->append(generation, Grid::snapshot());
+    }
+}
+
+// Charge une génération d'un journal delta
+void Grid::loadDeltaLog(const string& filename, long long target) {
+    DeltaLogReader log(filename);
+    if (target < 0) {
+        target = log.getLastGeneration();
+    }
+    vector<CellState> loaded;
+    if (!log.read(target, loaded)) {
+        throw runtime_error("Génération absente du journal delta.");
+    }
+    resize(log.getRows(), log.getCols());
+    cells.swap(loaded);
+    generation = target;
+
+    if (trajectory) {
+        trajectory->append(generation, snapshot());
+    }
+}
+
+// Empreinte de l'état de la grille
+uint64_t Grid::hash() const {
+    Pattern pattern = toPattern();
+    return BinarySnapshot::hash(rows, cols, pattern.alive.data(), pattern.obstacles.data(), pattern.alive.getWordCount());
+}
+
+// Redimensionne la grille ; toutes les cellules deviennent VIDE
+void Grid::resize(int r, int c) {
+    if (r != rows || c != cols) {
+        trajectory.reset(); // La trajectoire est liée aux anciennes dimensions
+    }
+    rows = r;
+    cols = c;
+    cells.assign(static_cast<size_t>(rows) * cols, VIDE);
+    current = GridSnapshot(rows, cols);
+    dirtyTiles.assign(static_cast<size_t>(current.getTileRows()) * current.getTileCols(), 0);
+    counterDirtyTiles.assign(dirtyTiles.size(), 0);
+    if (counterMode != GridSnapshot::AUCUN) {
+        counters.assign(cells.size(), 0);
+    }
+    resetHistory();
 }
 
 // Compte le nombre de voisins vivants autour d'une cellule
@@ -58,9 +264,14 @@ int Grid::countLivingNeighbors(int x, int y) {
             if (i == 0 && j == 0) continue;
             int newX = x + i;
             int newY = y + j;
-            // Vrifier les limites sans wrapping
+            if (toric) {
+                // Grille torique : les bords opposés sont voisins
+                newX = (newX + rows) % rows;
+                newY = (newY + cols) % cols;
+            }
+            // Vérifier les limites sans wrapping
             if (newX >= 0 && newX < rows && newY >= 0 && newY < cols) {
-                if (cells[newX][newY] == VIVANT) {
+                if (cells[static_cast<size_t>(newX) * cols + newY] == VIVANT) {
                     livingNeighbors++;
                 }
             }
@@ -69,87 +280,423 @@ int Grid::countLivingNeighbors(int x, int y) {
     return livingNeighbors;
 }
 
-// Sauvegarde l'tat actuel de la grille dans l'historique
+// Vide l'historique et repart d'un instantané entièrement à recapturer
+void Grid::resetHistory() {
+    clearHistory();
+    current = GridSnapshot(rows, cols);
+    dirtyTiles.assign(dirtyTiles.size(), 1);
+    // Nouveau contenu : les compteurs repartent de zéro
+    if (counterMode != GridSnapshot::AUCUN) {
+        current.setCounters(counterMode);
+        fill(counters.begin(), counters.end(), 0);
+        fill(counterDirtyTiles.begin(), counterDirtyTiles.end(), 0);
+    }
+}
+
+// Met à jour l'instantané courant avec les tuiles modifiées (la liste est transmise aux consommateurs)
+void Grid::flushDirtyTiles() {
+    uint64_t base = current.getVersion();
+    vector<int> changed;
+    for (int tr = 0; tr < current.getTileRows(); ++tr) {
+        for (int tc = 0; tc < current.getTileCols(); ++tc) {
+            int t = tr * current.getTileCols() + tc;
+            bool replaced = false;
+            if (dirtyTiles[t]) {
+                // Seules les tuiles modifiées sont réallouées, les autres restent partagées
+                GridSnapshot::TilePtr tile = GridSnapshot::capture(cells, rows, cols, tr, tc, current.getTile(tr, tc));
+                if (tile != current.getTile(tr, tc)) {
+                    current.setTile(tr, tc, tile);
+                    replaced = true;
+                }
+                dirtyTiles[t] = 0;
+            }
+            if (counterDirtyTiles[t]) {
+                GridSnapshot::TilePtr tile = GridSnapshot::captureCounters(counters, rows, cols, tr, tc, current.getCounterTile(tr, tc));
+                if (tile != current.getCounterTile(tr, tc)) {
+                    current.setCounterTile(tr, tc, tile);
+                    replaced = true;
+                }
+                counterDirtyTiles[t] = 0;
+            }
+            if (replaced) {
+                changed.push_back(t);
+            }
+        }
+    }
+    if (!changed.empty()) {
+        current.recordChanges(base, move(changed));
+    }
+}
+
+// Sauvegarde l'état actuel de la grille dans l'historique
 void Grid::saveState() {
-    history.push(cells); // Sauvegarder l'tat actuel dans la pile
-    cout << "Sauvegarde de l'tat actuel dans l'historique." << endl;
+    TRACE_SPAN("Grid::saveState");
+    flushDirtyTiles();
+    if (trajectory) {
+        // Les générations antérieures sont dans le fichier de trajectoire
+        clearHistory();
+    }
+    pushHistory(); // Sauvegarder l'état actuel dans la pile (tuiles partagées)
+    if (historyLimit > 0 && history.size() > historyLimit) {
+        popOldestHistory(); // Abandonner l'état le plus ancien
+    }
+    LOG_DEBUG("Sauvegarde de l'état actuel dans l'historique.");
+}
+
+// Ajoute l'état courant à l'historique en comptant ses tuiles propres
+void Grid::pushHistory() {
+    heldBytes += ownTileBytes(current, history.empty() ? nullptr : &history.back());
+    history.push_back(current);
 }
 
-// Met  jour la grille selon les rgles de la simulation
+// Abandonne l'état le plus ancien : le suivant devient le premier et compte toutes ses tuiles
+void Grid::popOldestHistory() {
+    heldBytes -= ownTileBytes(history[0], nullptr);
+    if (history.size() > 1) {
+        heldBytes = heldBytes - ownTileBytes(history[1], &history[0]) + ownTileBytes(history[1], nullptr);
+    }
+    history.pop_front();
+}
+
+void Grid::clearHistory() {
+    history.clear();
+    heldBytes = 0;
+}
+
+// Met à jour la grille selon les règles de la simulation
 void Grid::update() {
-    saveState(); // Sauvegarder l'tat avant la mise  jour
-    vector<vector<CellState>> newCells = cells;
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < cols; ++j) {
-            if (cells[i][j] == OBSTACLE) continue;
+    TRACE_SPAN("Grid::update");
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    saveState(); // Sauvegarder l'état avant la mise à jour
+    vector<CellState> newCells = cells;
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    int tileRows = current.getTileRows();
+    if (workers && workers->getThreadCount() > 1 && tileRows > 1) {
+        // Bandes alignées sur les tuiles : chaque thread marque ses propres tuiles et tient son propre bilan
+        int bands = min(tileRows, static_cast<int>(workers->getThreadCount()));
+        bandStats.assign(bands, GenerationStats());
+        for (int b = 0; b < bands; ++b) {
+            int firstRow = tileRows * b / bands * tileSize;
+            int lastRow = min(rows, tileRows * (b + 1) / bands * tileSize);
+            GenerationStats* stats = &bandStats[b];
+            workers->submit([this, firstRow, lastRow, &newCells, stats] { updateRows(firstRow, lastRow, newCells, *stats); });
+        }
+        workers->wait();
+        lastStats = GenerationStats();
+        for (const GenerationStats& stats : bandStats) {
+            lastStats += stats;
+        }
+    }
+    else {
+        updateRows(0, rows, newCells, lastStats);
+    }
+    cells.swap(newCells);
+    generation++;
+    if (trajectory) {
+        trajectory->append(generation, snapshot());
+    }
+    if (metrics) {
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        metrics->recordGeneration(lastStats, static_cast<long long>(rows) * cols, seconds, heldBytes);
+    }
+    LOG_DEBUG("Mise à jour de la grille terminée (génération " << generation << ").");
+}
 
-            int livingNeighbors = countLivingNeighbors(i, j);
-            if (cells[i][j] == VIVANT) {
-                if (livingNeighbors < 2 || livingNeighbors > 3) {
-                    newCells[i][j] = VIDE;
+// Calcule une bande de lignes de la génération suivante
+void Grid::updateRows(int firstRow, int lastRow, vector<CellState>& newCells, GenerationStats& stats) {
+    TRACE_SPAN("Grid::updateRows");
+    bool counting = counterMode != GridSnapshot::AUCUN;
+    long long population = 0;
+    long long births = 0;
+    long long deaths = 0;
+    for (int i = firstRow; i < lastRow; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            size_t index = static_cast<size_t>(i) * cols + j;
+            CellState state = cells[index];
+            if (state != OBSTACLE) {
+                int livingNeighbors = countLivingNeighbors(i, j);
+                if (state == VIVANT) {
+                    if (!rule.survives(livingNeighbors)) {
+                        newCells[index] = VIDE;
+                        markDirty(i, j);
+                        ++deaths;
+                    }
+                    else {
+                        ++population;
+                    }
                 }
-            }
-            else {
-                if (livingNeighbors == 3) {
-                    newCells[i][j] = VIVANT;
+                else {
+                    if (rule.isBorn(livingNeighbors)) {
+                        newCells[index] = VIVANT;
+                        markDirty(i, j);
+                        ++births;
+                        ++population;
+                    }
                 }
             }
+            if (counting) {
+                updateCounter(index, i, j, state, newCells[index]); // Compteurs calculés dans la même boucle
+            }
+        }
+    }
+    // Une seule écriture par bande : pas de partage entre threads dans la boucle
+    stats.population = population;
+    stats.births = births;
+    stats.deaths = deaths;
+}
+
+// Limite le nombre d'états conservés pour l'annulation
+void Grid::setHistoryLimit(size_t limit) {
+    historyLimit = limit;
+    while (historyLimit > 0 && history.size() > historyLimit) {
+        popOldestHistory();
+    }
+}
+
+// Répartit les mises à jour sur plusieurs threads
+void Grid::setThreads(unsigned threads) {
+    if (threads == 0) {
+        threads = max(1u, thread::hardware_concurrency());
+    }
+    if (threads == 1) {
+        workers.reset();
+    }
+    else if (!workers || workers->getThreadCount() != threads) {
+        workers = make_shared<WorkerPool>(threads);
+    }
+}
+
+// Active les compteurs par cellule (remis à zéro)
+void Grid::setCounterMode(GridSnapshot::Counters mode) {
+    if (mode == counterMode) {
+        return;
+    }
+    counterMode = mode;
+    if (mode == GridSnapshot::AUCUN) {
+        counters.clear();
+        counters.shrink_to_fit();
+    }
+    else {
+        counters.assign(cells.size(), 0);
+    }
+    fill(counterDirtyTiles.begin(), counterDirtyTiles.end(), 0);
+    current.setCounters(mode);
+}
+
+// Aligne les compteurs sur l'instantané courant (seules les tuiles différentes sont recopiées)
+void Grid::restoreCounters(const GridSnapshot& replaced) {
+    if (counterMode == GridSnapshot::AUCUN) {
+        if (current.getCounters() != GridSnapshot::AUCUN) {
+            current.setCounters(GridSnapshot::AUCUN);
+        }
+        return;
+    }
+    if (current.getCounters() != counterMode) {
+        // L'instantané ne porte pas ces compteurs : ils repartent de zéro
+        current.setCounters(counterMode);
+        fill(counters.begin(), counters.end(), 0);
+        fill(counterDirtyTiles.begin(), counterDirtyTiles.end(), 0);
+        return;
+    }
+    for (int tr = 0; tr < current.getTileRows(); ++tr) {
+        for (int tc = 0; tc < current.getTileCols(); ++tc) {
+            size_t t = static_cast<size_t>(tr) * current.getTileCols() + tc;
+            if (counterDirtyTiles[t] || current.getCounterTile(tr, tc) != replaced.getCounterTile(tr, tc)) {
+                current.restoreCounterTile(counters, tr, tc);
+            }
+            counterDirtyTiles[t] = 0;
         }
     }
-    cells = newCells;
-    cout << "Mise  jour de la grille termine." << endl;
 }
 
-// Annule la dernire mise  jour de la grille
+// Annule la dernière mise à jour de la grille
 void Grid::undo() {
+    TRACE_SPAN("Grid::undo");
     if (!history.empty()) {
-        cells = history.top(); // Restaurer l'tat prcdent
-        history.pop();         // Retirer cet tat de la pile
-        cout << "Annulation de la dernire mise  jour." << endl;
+        const GridSnapshot& previous = history.back();
+        // Restaurer l'état précédent : seules les tuiles différentes sont recopiées
+        for (int tr = 0; tr < previous.getTileRows(); ++tr) {
+            for (int tc = 0; tc < previous.getTileCols(); ++tc) {
+                size_t t = static_cast<size_t>(tr) * previous.getTileCols() + tc;
+                if (dirtyTiles[t] || previous.getTile(tr, tc) != current.getTile(tr, tc)) {
+                    previous.restoreTile(cells, tr, tc);
+                }
+                dirtyTiles[t] = 0;
+            }
+        }
+        GridSnapshot replaced = current;
+        current = previous;
+        restoreCounters(replaced);
+        heldBytes -= ownTileBytes(previous, history.size() > 1 ? &history[history.size() - 2] : nullptr);
+        history.pop_back();    // Retirer cet état de la pile
+        generation--;
+        LOG_INFO("Annulation de la dernière mise à jour.");
+    }
+    else if (trajectory && seekGeneration(generation - 1)) {
+        LOG_INFO("Annulation de la dernière mise à jour.");
     }
     else {
-        cout << "Aucun tat  annuler." << endl;
+        LOG_INFO("Aucun état à annuler.");
     }
 }
 
-// Vrifie si la grille a atteint un tat stable
+// Vérifie si la grille a atteint un état stable
 bool Grid::hasStableState() const {
     if (history.empty()) return false;
-    return cells == history.top(); // Comparer avec l'tat prcdent
+    // Comparer avec l'état précédent, en sautant les tuiles partagées et intactes
+    const GridSnapshot& previous = history.back();
+    for (int tr = 0; tr < previous.getTileRows(); ++tr) {
+        for (int tc = 0; tc < previous.getTileCols(); ++tc) {
+            size_t t = static_cast<size_t>(tr) * previous.getTileCols() + tc;
+            if (!dirtyTiles[t] && previous.getTile(tr, tc) == current.getTile(tr, tc)) continue;
+            if (!previous.matchesTile(cells, tr, tc)) {
+                return false;
+            }
+        }
+    }
+    return true;
 }
 
-// Dessine la grille dans une fentre SFML
-void Grid::draw(sf::RenderWindow& window, int cellSize) const {
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < cols; ++j) {
-            sf::RectangleShape cell(sf::Vector2f(cellSize, cellSize));
-            cell.setPosition(j * cellSize, i * cellSize);
+// Retourne un instantané de l'état actuel
+GridSnapshot Grid::snapshot() {
+    flushDirtyTiles();
+    return current;
+}
 
-            if (cells[i][j] == VIVANT) {
-                cell.setFillColor(sf::Color::White);
-            }
-            else if (cells[i][j] == OBSTACLE) {
-                cell.setFillColor(sf::Color::Red);
-            }
-            else {
-                cell.setFillColor(sf::Color::Black);
+// Restaure un instantané de mêmes dimensions
+void Grid::restore(const GridSnapshot& snapshot) {
+    if (snapshot.getRows() != rows || snapshot.getCols() != cols) {
+        throw invalid_argument("Dimensions de l'instantané incompatibles avec la grille.");
+    }
+    saveState(); // L'état remplacé reste annulable
+    for (int tr = 0; tr < snapshot.getTileRows(); ++tr) {
+        for (int tc = 0; tc < snapshot.getTileCols(); ++tc) {
+            if (snapshot.getTile(tr, tc) != current.getTile(tr, tc)) {
+                snapshot.restoreTile(cells, tr, tc);
             }
-
-            window.draw(cell);
         }
     }
+    GridSnapshot replaced = current;
+    current = snapshot;
+    restoreCounters(replaced);
+    generation++;
+    if (trajectory) {
+        trajectory->append(generation, Grid::snapshot());
+    }
+}
+
+// Crée une copie indépendante de la grille à partir de l'état actuel
+Grid Grid::fork() {
+    flushDirtyTiles();
+    Grid copy = *this; // Les instantanés de l'historique partagent leurs tuiles
+    copy.trajectory.reset(); // La copie n'écrit pas dans la trajectoire de l'original
+    copy.metrics.reset(); // Ni dans ses mesures
+    copy.workers.reset(); // Et n'attend pas sur les threads de l'original : elle a les siens
+    if (workers) {
+        copy.setThreads(workers->getThreadCount());
+    }
+    return copy;
+}
+
+// Enregistre les générations suivantes dans un fichier de trajectoire
+void Grid::recordTrajectory(const string& filename, int keyframeInterval) {
+    trajectory = make_shared<Trajectory>(filename, rows, cols, keyframeInterval);
+    trajectory->append(generation, snapshot());
+    clearHistory();
 }
 
-// Bascule l'tat d'une cellule en fonction des coordonnes de la souris
+// Reprend une trajectoire existante à sa dernière génération complète
+void Grid::resumeTrajectory(const string& filename) {
+    shared_ptr<Trajectory> resumed = make_shared<Trajectory>(filename);
+    if (resumed->getRows() != rows || resumed->getCols() != cols) {
+        resize(resumed->getRows(), resumed->getCols());
+    }
+    trajectory = resumed;
+    if (!seekGeneration(trajectory->getLastGeneration())) {
+        trajectory->append(generation, snapshot()); // Trajectoire vide : repartir de l'état actuel
+    }
+}
+
+// Revient à une génération enregistrée dans la trajectoire
+bool Grid::seekGeneration(long long target) {
+    if (!trajectory || !trajectory->contains(target)) {
+        return false;
+    }
+    trajectory->read(target, cells);
+    generation = target;
+    resetHistory(); // Toutes les tuiles sont à recapturer
+    return true;
+}
+
+// Bascule l'état d'une cellule en fonction des coordonnées de la souris
 void Grid::toggleCell(int mouseX, int mouseY, int cellSize, CellState state) {
     int col = mouseX / cellSize;
     int row = mouseY / cellSize;
     if (row >= 0 && row < rows && col >= 0 && col < cols) {
+        CellState& cell = cells[static_cast<size_t>(row) * cols + col];
         if (state == OBSTACLE) {
-            cells[row][col] = OBSTACLE;
+            cell = OBSTACLE;
         }
-        else if (cells[row][col] != OBSTACLE) {
-            cells[row][col] = state;
+        else if (cell != OBSTACLE) {
+            cell = state;
+        }
+        markDirty(row, col);
+    }
+}
+
+// Applique un motif par plages de bits consécutifs
+void Grid::stamp(const BitPlane& shape, int top, int left, CellState state) {
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    // Donne l'état aux cellules [col, col + length) d'une ligne de la grille
+    auto fillRun = [&](int row, int col, int length) {
+        CellState* cell = &cells[static_cast<size_t>(row) * cols + col];
+        for (int j = 0; j < length; ++j) {
+            if (state == OBSTACLE || cell[j] != OBSTACLE) {
+                cell[j] = state;
+            }
+        }
+        for (int tc = col / tileSize; tc <= (col + length - 1) / tileSize; ++tc) {
+            markDirty(row, tc * tileSize);
+        }
+    };
+
+    for (int i = 0; i < shape.getRows(); ++i) {
+        int row = top + i;
+        if (toric) {
+            row = ((row % rows) + rows) % rows;
+        }
+        else if (row < 0 || row >= rows) {
+            continue;
+        }
+        const uint64_t* words = shape.rowData(i);
+        for (int w = 0; w < shape.getWordsPerRow(); ++w) {
+            uint64_t bits = words[w];
+            while (bits) {
+                // Plage de bits à un commençant au bit de poids faible
+                int first = BitPlane::lowestBit(bits);
+                uint64_t rest = ~(bits >> first);
+                int length = rest ? BitPlane::lowestBit(rest) : 64 - first;
+                bits = first + length >= 64 ? 0 : bits & ~(((uint64_t(1) << length) - 1) << first);
+
+                int col = left + w * 64 + first;
+                if (toric) {
+                    // Découpage de la plage aux bords de la grille
+                    while (length > 0) {
+                        int start = ((col % cols) + cols) % cols;
+                        int count = min(length, cols - start);
+                        fillRun(row, start, count);
+                        col += count;
+                        length -= count;
+                    }
+                }
+                else {
+                    int start = max(col, 0);
+                    int end = min(col + length, cols);
+                    if (start < end) {
+                        fillRun(row, start, end - start);
+                    }
+                }
+            }
         }
     }
 }
@@ -158,9 +705,10 @@ void Grid::toggleCell(int mouseX, int mouseY, int cellSize, CellState state) {
 void Grid::print() const {
     for (int i = 0; i < rows; ++i) {
         for (int j = 0; j < cols; ++j) {
-            if (cells[i][j] == VIVANT)
+            CellState state = cells[static_cast<size_t>(i) * cols + j];
+            if (state == VIVANT)
                 cout << "1 ";
-            else if (cells[i][j] == OBSTACLE)
+            else if (state == OBSTACLE)
                 cout << "X ";
             else
                 cout << "0 ";
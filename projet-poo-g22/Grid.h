@@ -3,21 +3,44 @@
 #define GRID_H
 
 #include "Cellule.h"
+#include "Snapshot.h"
+#include "Trajectory.h"
+#include "Rule.h"
+#include "RLE.h"
+#include "WorkerPool.h"
+#include "Metrics.h"
 #include <vector>
-#include <stack>
+#include <deque>
 #include <string>
-#include <SFML/Graphics.hpp>
+#include <memory>
+#include <cstdint>
 
 /**
- * @brief Classe reprsentant la grille de simulation.
+ * @brief Classe représentant la grille de simulation.
  *
- * Cette classe gre l'tat de chaque cellule, les mises  jour de la grille,
- * les oprations d'annulation, et le dessin de la grille dans l'interface graphique.
+ * Cette classe gère l'état de chaque cellule, les mises à jour de la grille,
+ * et les opérations d'annulation. Le dessin est assuré par GridRenderer
+ * (interface graphique) à partir des instantanés.
  */
 class Grid {
 private:
-    std::vector<std::vector<CellState>> cells;
-    std::stack<std::vector<std::vector<CellState>>> history; // Pile pour stocker les tats prcdents
+    std::vector<CellState> cells; // Cellules ligne par ligne (rows x cols)
+    std::deque<GridSnapshot> history; // Pile des états précédents (le plus récent à la fin)
+    std::size_t historyLimit; // Nombre maximal d'états conservés (0 : illimité)
+    std::size_t heldBytes; // Octets des tuiles propres à chaque état de l'historique (voir historyBytes)
+    std::shared_ptr<WorkerPool> workers; // Threads de mise à jour (optionnel)
+    GridSnapshot current; // Dernier instantané, à jour hors tuiles modifiées
+    std::vector<unsigned char> dirtyTiles; // Tuiles modifiées depuis current
+    GridSnapshot::Counters counterMode; // Compteurs tenus à jour (AUCUN par défaut)
+    std::vector<unsigned char> counters; // Compteurs par cellule, saturés à 255 (vide sans compteurs)
+    std::vector<unsigned char> counterDirtyTiles; // Tuiles dont les compteurs ont changé depuis current
+    std::shared_ptr<Trajectory> trajectory; // Historique sur disque (optionnel)
+    std::shared_ptr<Metrics> metrics; // Mesures de performance (optionnel)
+    std::vector<GenerationStats> bandStats; // Bilan de chaque bande de lignes (un par thread)
+    GenerationStats lastStats; // Bilan de la dernière génération
+    long long generation; // Numéro de la génération courante
+    Rule rule; // Règle de naissance et de survie (B3/S23 par défaut)
+    bool toric; // Bords opposés connectés
     int rows;
     int cols;
 
@@ -31,11 +54,85 @@ private:
     int countLivingNeighbors(int x, int y);
 
     /**
-     * @brief Sauvegarde l'tat actuel de la grille dans l'historique.
+     * @brief Sauvegarde l'état actuel de la grille dans l'historique.
      */
     void saveState();
 
+    /**
+     * @brief Ajoute l'état courant à l'historique.
+     */
+    void pushHistory();
+
+    /**
+     * @brief Abandonne l'état le plus ancien de l'historique.
+     */
+    void popOldestHistory();
+
+    /**
+     * @brief Vide l'historique.
+     */
+    void clearHistory();
+
+    /**
+     * @brief Calcule les lignes [firstRow, lastRow) de la génération suivante.
+     *
+     * Le bilan des lignes est cumulé dans des variables locales puis écrit
+     * une seule fois dans stats, propre à la bande.
+     */
+    void updateRows(int firstRow, int lastRow, std::vector<CellState>& newCells, GenerationStats& stats);
+
+    /**
+     * @brief Marque la tuile contenant une cellule comme modifiée.
+     */
+    void markDirty(int row, int col) {
+        dirtyTiles[(row / GridSnapshot::TILE_SIZE) * current.getTileCols() + col / GridSnapshot::TILE_SIZE] = 1;
+    }
+
+    /**
+     * @brief Met à jour le compteur d'une cellule après le calcul de son nouvel état.
+     */
+    void updateCounter(std::size_t index, int row, int col, CellState before, CellState after) {
+        unsigned char& counter = counters[index];
+        unsigned value = counter;
+        if (counterMode == GridSnapshot::AGE) {
+            value = after != VIVANT ? 0 : before == VIVANT ? (value < 255 ? value + 1 : 255) : 1;
+        }
+        else if ((before == VIVANT) != (after == VIVANT)) {
+            value = value + HEAT_GAIN < 255 ? value + HEAT_GAIN : 255; // Changement d'état : la cellule chauffe
+        }
+        else {
+            value -= (value + HEAT_DECAY - 1) / HEAT_DECAY; // Refroidissement (jusqu'à zéro)
+        }
+        if (value != counter) {
+            counter = static_cast<unsigned char>(value);
+            counterDirtyTiles[(row / GridSnapshot::TILE_SIZE) * current.getTileCols() + col / GridSnapshot::TILE_SIZE] = 1;
+        }
+    }
+
+    /**
+     * @brief Aligne le plan des compteurs sur l'instantané courant qui vient de remplacer replaced.
+     *
+     * Les compteurs sont remis à zéro si l'instantané n'en porte pas de la même sorte.
+     */
+    void restoreCounters(const GridSnapshot& replaced);
+
+    /**
+     * @brief Met à jour l'instantané courant avec les tuiles modifiées.
+     *
+     * La liste des tuiles remplacées est enregistrée dans l'instantané
+     * (GridSnapshot::changedTiles) pour les consommateurs.
+     */
+    void flushDirtyTiles();
+
+    /**
+     * @brief Vide l'historique et repart d'un instantané entièrement à recapturer.
+     */
+    void resetHistory();
+
 public:
+    static const unsigned HEAT_GAIN = 64; // Activité ajoutée à chaque changement d'état
+    static const unsigned HEAT_DECAY = 16; // L'activité perd 1/HEAT_DECAY par génération
+
     /**
      * @brief Constructeur de la grille.
      *
@@ -45,24 +142,190 @@ public:
     Grid(int r, int c);
 
     /**
-     * @brief Initialise la grille  partir d'un fichier.
+     * @brief Construit une grille à partir d'un instantané.
+     *
+     * @param snapshot Instantané dont les tuiles sont partagées.
+     */
+    explicit Grid(const GridSnapshot& snapshot);
+
+    /**
+     * @brief Initialise la grille à partir d'un fichier.
+     *
+     * L'historique est vidé et la génération repart de 0.
      *
      * @param filename Nom du fichier contenant la configuration initiale.
      */
     void initializeFromInput(const std::string& filename);
 
     /**
-     * @brief Met  jour la grille selon les rgles de la simulation.
+     * @brief Initialise la grille à partir d'un fichier en adoptant ses dimensions.
+     *
+     * Le nombre de colonnes est celui de la première ligne, le nombre de
+     * lignes celui des lignes non vides du fichier. L'historique est vidé et
+     * la génération repart de 0.
+     *
+     * @param filename Nom du fichier contenant la configuration initiale.
+     * @throws std::runtime_error Si le fichier est introuvable ou vide.
+     */
+    void loadFromInput(const std::string& filename);
+
+    /**
+     * @brief Initialise la grille à partir d'un fichier RLE.
+     *
+     * Le motif est centré ; la grille est agrandie s'il ne tient pas. La
+     * règle de l'en-tête remplace la règle courante.
+     *
+     * @param filename Nom du fichier RLE.
+     * @throws std::runtime_error Si le fichier ne peut pas être lu.
+     */
+    void initializeFromRLE(const std::string& filename);
+
+    /**
+     * @brief Enregistre la grille au format RLE.
+     *
+     * @param filename Nom du fichier RLE.
+     * @throws std::runtime_error Si le fichier ne peut pas être créé.
+     */
+    void saveRLE(const std::string& filename) const;
+
+    /**
+     * @brief Initialise la grille à partir d'un fichier Macrocell (.mc).
+     *
+     * Le rectangle englobant des cellules du motif est converti sans perte
+     * en grille à plat, centré comme un motif RLE. La règle de l'en-tête
+     * remplace la règle courante.
+     *
+     * @param filename Nom du fichier Macrocell.
+     * @throws std::runtime_error Si le fichier est invalide ou si le motif est trop grand pour une grille à plat.
+     */
+    void initializeFromMacrocell(const std::string& filename);
+
+    /**
+     * @brief Enregistre la grille au format Macrocell.
+     *
+     * @param filename Nom du fichier Macrocell.
+     * @throws std::runtime_error Si le fichier ne peut pas être créé.
+     */
+    void saveMacrocell(const std::string& filename) const;
+
+    /**
+     * @brief Enregistre la grille dans un instantané binaire.
+     *
+     * @param filename Nom du fichier.
+     * @param compress Compresser les plans de bits.
+     * @throws std::runtime_error Si le fichier ne peut pas être écrit.
+     */
+    void saveBinary(const std::string& filename, bool compress = true) const;
+
+    /**
+     * @brief Charge un instantané binaire.
+     *
+     * Les dimensions, la règle, la topologie et le numéro de génération
+     * sont ceux de l'instantané ; l'historique est vidé.
+     *
+     * @param filename Nom du fichier.
+     * @throws std::runtime_error Si le fichier est invalide ou corrompu.
+     */
+    void loadBinary(const std::string& filename);
+
+    /**
+     * @brief Charge une génération d'un journal delta (voir OutputWriter).
+     *
+     * Les dimensions sont celles du journal et la génération celle qui est
+     * chargée ; l'historique est vidé.
+     *
+     * @param filename Nom du fichier.
+     * @param generation Génération à charger (-1 pour la dernière du journal).
+     * @throws std::runtime_error Si le fichier est invalide ou si la génération est absente.
+     */
+    void loadDeltaLog(const std::string& filename, long long generation = -1);
+
+    /**
+     * @brief Empreinte 64 bits de l'état de la grille (dimensions et cellules).
+     */
+    std::uint64_t hash() const;
+
+    /**
+     * @brief Remplace le contenu de la grille par un motif centré.
+     *
+     * L'historique est vidé et la génération repart de 0 (fichiers RLE et
+     * Macrocell compris).
+     *
+     * @param pattern Motif à charger (cellules vivantes, obstacles et règle).
+     */
+    void loadPattern(const Pattern& pattern);
+
+    /**
+     * @brief Retourne le contenu de la grille sous forme de plans de bits.
+     */
+    Pattern toPattern() const;
+
+    /**
+     * @brief Redimensionne la grille ; toutes les cellules deviennent VIDE.
+     *
+     * L'historique est vidé et la trajectoire éventuelle est fermée si les
+     * dimensions changent.
+     *
+     * @param r Nombre de lignes.
+     * @param c Nombre de colonnes.
+     */
+    void resize(int r, int c);
+
+    /**
+     * @brief Met à jour la grille selon les règles de la simulation.
      */
     void update();
 
     /**
-     * @brief Annule la dernire mise  jour de la grille.
+     * @brief Annule la dernière mise à jour de la grille.
+     *
+     * Avec une trajectoire active, les générations antérieures sont relues
+     * depuis le fichier.
      */
     void undo();
 
     /**
-     * @brief Vrifie si la grille a atteint un tat stable.
+     * @brief Enregistre les générations suivantes dans un fichier de trajectoire.
+     *
+     * L'historique en mémoire est remplacé par le fichier : seule la
+     * génération précédente reste en mémoire pour hasStableState().
+     *
+     * @param filename Nom du fichier (écrasé s'il existe).
+     * @param keyframeInterval Nombre de générations entre deux images clés.
+     * @throws std::runtime_error Si le fichier ne peut pas être créé.
+     */
+    void recordTrajectory(const std::string& filename, int keyframeInterval = 64);
+
+    /**
+     * @brief Reprend une trajectoire existante à sa dernière génération complète.
+     *
+     * La grille adopte les dimensions de la trajectoire, et les générations
+     * suivantes prolongent le fichier.
+     *
+     * @param filename Nom du fichier de trajectoire.
+     * @throws std::runtime_error Si le fichier est invalide.
+     */
+    void resumeTrajectory(const std::string& filename);
+
+    /**
+     * @brief Vérifie si les générations sont enregistrées dans une trajectoire.
+     */
+    bool hasTrajectory() const { return trajectory != nullptr; }
+
+    /**
+     * @brief Revient à une génération enregistrée dans la trajectoire.
+     *
+     * Les mises à jour suivantes repartent de cette génération et remplacent
+     * les générations ultérieures du fichier.
+     *
+     * @param target Numéro de la génération.
+     * @return true Si la génération a été chargée.
+     * @return false Si aucune trajectoire n'est active ou si la génération est absente.
+     */
+    bool seekGeneration(long long target);
+
+    /**
+     * @brief Vérifie si la grille a atteint un état stable.
      *
      * @return true Si la grille est stable.
      * @return false Sinon.
@@ -70,23 +333,126 @@ public:
     bool hasStableState() const;
 
     /**
-     * @brief Dessine la grille dans une fentre SFML.
+     * @brief Retourne un instantané de l'état actuel.
      *
-     * @param window Rfrence  la fentre SFML.
-     * @param cellSize Taille de chaque cellule en pixels.
+     * L'instantané partage ses tuiles avec l'historique : seul son tableau
+     * de tuiles est copié.
+     *
+     * @return GridSnapshot Instantané de la grille.
+     */
+    GridSnapshot snapshot();
+
+    /**
+     * @brief Restaure un instantané de mêmes dimensions.
+     *
+     * L'état actuel est sauvegardé dans l'historique et peut être annulé.
+     *
+     * @param snapshot Instantané à restaurer.
      */
-    void draw(sf::RenderWindow& window, int cellSize) const;
+    void restore(const GridSnapshot& snapshot);
 
     /**
-     * @brief Bascule l'tat d'une cellule en fonction des coordonnes de la souris.
+     * @brief Crée une copie indépendante de la grille à partir de l'état actuel.
+     *
+     * La copie partage les tuiles de l'historique, qu'elle conserve. Elle a
+     * ses propres threads de mise à jour, n'écrit pas dans la trajectoire de
+     * l'original et ne fait pas partie de ses mesures.
+     *
+     * @return Grid Nouvelle grille.
+     */
+    Grid fork();
+
+    /**
+     * @brief Nombre d'états conservés dans l'historique.
+     */
+    std::size_t historySize() const { return history.size(); }
+
+    /**
+     * @brief Mémoire occupée par les tuiles de l'historique, en octets.
+     *
+     * Chaque état ne compte que les tuiles qu'il ne partage pas avec l'état
+     * précédent de la pile ; le total est tenu à jour à chaque ajout ou
+     * retrait, sans parcourir l'historique.
+     */
+    std::size_t historyBytes() const { return heldBytes; }
+
+    /**
+     * @brief Enregistre la durée et le bilan de chaque génération.
+     *
+     * Le bilan (population, naissances, morts) est calculé par la boucle de
+     * mise à jour même sans mesures : getLastStats() reste disponible.
+     *
+     * @param m Mesures à alimenter, ou nullptr pour les désactiver.
+     */
+    void setMetrics(std::shared_ptr<Metrics> m) { metrics = m; }
+    const std::shared_ptr<Metrics>& getMetrics() const { return metrics; }
+
+    /**
+     * @brief Bilan de la dernière génération calculée.
+     */
+    const GenerationStats& getLastStats() const { return lastStats; }
+
+    /**
+     * @brief Limite le nombre d'états conservés pour l'annulation.
+     *
+     * Au-delà, les états les plus anciens sont abandonnés. Une limite d'au
+     * moins 1 conserve la détection d'état stable.
+     *
+     * @param limit Nombre maximal d'états (0 : illimité).
+     */
+    void setHistoryLimit(std::size_t limit);
+
+    /**
+     * @brief Répartit les mises à jour sur plusieurs threads.
+     *
+     * La grille est découpée en bandes de lignes de tuiles, chacune mise à
+     * jour par un thread ; le résultat est identique à la mise à jour
+     * séquentielle.
+     *
+     * @param threads Nombre de threads (1 : séquentiel, 0 : selon le matériel).
+     */
+    void setThreads(unsigned threads);
+
+    /**
+     * @brief Active des compteurs par cellule, mis à jour à chaque génération.
+     *
+     * AGE compte les générations vécues par chaque cellule vivante ;
+     * ACTIVITE augmente de HEAT_GAIN à chaque changement d'état et décroît
+     * d'environ 1/HEAT_DECAY par génération. Les compteurs sont calculés
+     * avec les cellules, dans la même boucle, et transmis par les
+     * instantanés (GridSnapshot::getCounterTile) : l'affichage n'a rien à
+     * recalculer. Changer de sorte remet les compteurs à zéro.
+     *
+     * @param mode Compteurs à tenir à jour (AUCUN : désactivés).
+     */
+    void setCounterMode(GridSnapshot::Counters mode);
+
+    /**
+     * @brief Bascule l'état d'une cellule en fonction des coordonnées de la souris.
      *
      * @param mouseX Position X de la souris.
      * @param mouseY Position Y de la souris.
      * @param cellSize Taille de chaque cellule en pixels.
-     * @param state Nouvel tat  attribuer  la cellule.
+     * @param state Nouvel état à attribuer à la cellule.
      */
     void toggleCell(int mouseX, int mouseY, int cellSize, CellState state);
 
+    /**
+     * @brief Applique un motif (pinceau ou construction) en une seule modification.
+     *
+     * Chaque bit à un du motif donne l'état state à la cellule correspondante ;
+     * comme pour toggleCell, les obstacles ne sont remplacés que par un obstacle.
+     * Les bits sont parcourus par plages à partir des mots du plan. Hors de la
+     * grille, le motif est coupé (ou replié sur les bords opposés si la grille
+     * est torique).
+     *
+     * @param shape Motif à appliquer.
+     * @param top Ligne du coin supérieur gauche du motif.
+     * @param left Colonne du coin supérieur gauche du motif.
+     * @param state État à attribuer aux cellules du motif.
+     */
+    void stamp(const BitPlane& shape, int top, int left, CellState state);
+
     /**
      * @brief Affiche la grille dans la console.
      */
@@ -95,7 +461,14 @@ public:
     // Getters
     int getRows() const { return rows; }
     int getCols() const { return cols; }
-    CellState getCellState(int row, int col) const { return cells[row][col]; }
+    long long getGeneration() const { return generation; }
+    const Rule& getRule() const { return rule; }
+    void setRule(const Rule& r) { rule = r; }
+    bool isToric() const { return toric; }
+    void setToric(bool t) { toric = t; }
+    CellState getCellState(int row, int col) const { return cells[static_cast<std::size_t>(row) * cols + col]; }
+    GridSnapshot::Counters getCounterMode() const { return counterMode; }
+    unsigned getCounter(int row, int col) const { return counters.empty() ? 0 : counters[static_cast<std::size_t>(row) * cols + col]; }
 };
 
 #endif // GRID_H
\ No newline at end of file
@@ -0,0 +1,86 @@
+// interfaces/GridRenderer.cpp
+#include "GridRenderer.h"
+#include "Palette.h"
+#include "Trace.h"
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+// Couleur d'une cellule selon son état et son compteur
+sf::Color colorOf(GridSnapshot::Counters counters, unsigned char state, unsigned char counter) {
+    unsigned char rgb[3];
+    Palette::blockColor(counters, 1, (state & 3) == VIVANT, (state & 3) == OBSTACLE, counter, rgb);
+    return sf::Color(rgb[0], rgb[1], rgb[2]);
+}
+
+} // namespace
+
+GridRenderer::GridRenderer(int size) : cellSize(size), vertices(sf::Quads) {}
+
+// Reconstruit les quadrilatères (toutes les cellules VIDE)
+void GridRenderer::rebuild(int rows, int cols) {
+    vertices.resize(static_cast<size_t>(rows) * cols * 4);
+    float size = static_cast<float>(cellSize);
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            sf::Vertex* quad = &vertices[(static_cast<size_t>(i) * cols + j) * 4];
+            float x = j * size;
+            float y = i * size;
+            quad[0].position = sf::Vector2f(x, y);
+            quad[1].position = sf::Vector2f(x + size, y);
+            quad[2].position = sf::Vector2f(x + size, y + size);
+            quad[3].position = sf::Vector2f(x, y + size);
+            for (int k = 0; k < 4; ++k) {
+                quad[k].color = sf::Color::Black;
+            }
+        }
+    }
+    previous = GridSnapshot(rows, cols);
+}
+
+void GridRenderer::setColor(int row, int col, const sf::Color& color) {
+    sf::Vertex* quad = &vertices[(static_cast<size_t>(row) * previous.getCols() + col) * 4];
+    quad[0].color = color;
+    quad[1].color = color;
+    quad[2].color = color;
+    quad[3].color = color;
+}
+
+// Met à jour les couleurs des cellules des tuiles modifiées depuis le dernier instantané
+void GridRenderer::update(const GridSnapshot& snapshot) {
+    TRACE_SPAN("GridRenderer::update");
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    int rows = snapshot.getRows();
+    int cols = snapshot.getCols();
+    if (rows != previous.getRows() || cols != previous.getCols()) {
+        rebuild(rows, cols);
+    }
+
+    snapshot.changedTiles(previous, changedTiles);
+    for (int t : changedTiles) {
+        int tr = t / snapshot.getTileCols();
+        int tc = t % snapshot.getTileCols();
+        const GridSnapshot::TilePtr& tile = snapshot.getTile(tr, tc);
+        const GridSnapshot::TilePtr& before = previous.getTile(tr, tc);
+        const GridSnapshot::TilePtr& counters = snapshot.getCounterTile(tr, tc);
+        const GridSnapshot::TilePtr& countersBefore = previous.getCounterTile(tr, tc);
+        int height = min(tileSize, rows - tr * tileSize);
+        int width = min(tileSize, cols - tc * tileSize);
+        for (int i = 0; i < height; ++i) {
+            int offset = i * tileSize;
+            for (int j = offset; j < offset + width; ++j) {
+                sf::Color color = colorOf(snapshot.getCounters(), tile->cells[j], counters->cells[j]);
+                if (color != colorOf(previous.getCounters(), before->cells[j], countersBefore->cells[j])) {
+                    setColor(tr * tileSize + i, tc * tileSize + j - offset, color);
+                }
+            }
+        }
+    }
+    previous = snapshot;
+}
+
+void GridRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    target.draw(vertices, states);
+}
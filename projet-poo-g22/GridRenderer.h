@@ -0,0 +1,50 @@
+// interfaces/GridRenderer.h
+#ifndef GRIDRENDERER_H
+#define GRIDRENDERER_H
+
+#include "Snapshot.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+/**
+ * @brief Dessin de la grille en un seul appel SFML.
+ *
+ * Chaque cellule est un quadrilatère d'un tableau de sommets conservé
+ * d'une image à l'autre. update() ne modifie que la couleur des cellules
+ * qui ont changé : seules les tuiles qui ne sont plus partagées avec
+ * l'instantané précédent sont comparées. Les couleurs sont celles de
+ * l'affichage d'origine (vivante en blanc, obstacle en rouge, vide en noir),
+ * ou celles des compteurs d'âge ou d'activité si l'instantané en porte
+ * (Palette).
+ */
+class GridRenderer : public sf::Drawable {
+public:
+    /**
+     * @brief Construit un affichage vide.
+     *
+     * @param cellSize Taille de chaque cellule en pixels.
+     */
+    explicit GridRenderer(int cellSize);
+
+    /**
+     * @brief Met à jour les couleurs à partir d'un instantané de la grille.
+     *
+     * La géométrie est reconstruite si les dimensions de la grille changent.
+     */
+    void update(const GridSnapshot& snapshot);
+
+    // Getters
+    int getCellSize() const { return cellSize; }
+
+private:
+    int cellSize;
+    sf::VertexArray vertices;
+    GridSnapshot previous; // Dernier instantané affiché
+    std::vector<int> changedTiles; // Tuiles modifiées depuis previous
+
+    void rebuild(int rows, int cols);
+    void setColor(int row, int col, const sf::Color& color);
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
+
+#endif // GRIDRENDERER_H
@@ -0,0 +1,218 @@
+// interfaces/Headless.cpp
+#include "Headless.h"
+#include "OutputWriter.h"
+#include "ImageExporter.h"
+#include "Log.h"
+#include "Trace.h"
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <chrono>
+#include <memory>
+
+using namespace std;
+
+namespace {
+
+bool endsWith(const string& text, const string& suffix) {
+    return text.size() > suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+long long toNumber(const string& option, const string& value, long long minimum) {
+    size_t end = 0;
+    long long number = 0;
+    try {
+        number = stoll(value, &end);
+    }
+    catch (const exception&) {
+        end = 0;
+    }
+    if (end == 0 || end != value.size() || number < minimum) {
+        throw runtime_error("Valeur invalide pour " + option + " : " + value);
+    }
+    return number;
+}
+
+} // namespace
+
+HeadlessOptions::HeadlessOptions()
+    : rows(0), cols(0), toric(false), density(0.0), seed(1), generations(100), threads(1), engine("flat"),
+      untilStable(false), history(1), imageFormat("png"), imageEvery(1), imageSize(0), metricsEvery(1000) {}
+
+// Lit les options de la ligne de commande
+HeadlessOptions HeadlessOptions::parse(int argc, char* argv[]) {
+    HeadlessOptions options;
+    bool random = false; // --random donné, même avec une densité nulle
+    for (int i = 1; i < argc; ++i) {
+        string option = argv[i];
+        if (option == "--toric") {
+            options.toric = true;
+            continue;
+        }
+        if (option == "--until-stable") {
+            options.untilStable = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            throw runtime_error("Option inconnue ou sans valeur : " + option);
+        }
+        string value = argv[++i];
+        if (option == "-i" || option == "--input") options.input = value;
+        else if (option == "--rows") options.rows = static_cast<int>(toNumber(option, value, 1));
+        else if (option == "--cols") options.cols = static_cast<int>(toNumber(option, value, 1));
+        else if (option == "--rule") options.rule = value;
+        else if (option == "--seed") options.seed = static_cast<unsigned>(toNumber(option, value, 0));
+        else if (option == "-g" || option == "--generations") options.generations = toNumber(option, value, 0);
+        else if (option == "-t" || option == "--threads") options.threads = static_cast<unsigned>(toNumber(option, value, 0));
+        else if (option == "--engine") options.engine = value;
+        else if (option == "--history") options.history = static_cast<size_t>(toNumber(option, value, 0));
+        else if (option == "--log") options.log = value;
+        else if (option == "--save") options.save = value;
+        else if (option == "--trajectory") options.trajectory = value;
+        else if (option == "--images") options.images = value;
+        else if (option == "--image-format") options.imageFormat = value;
+        else if (option == "--image-every") options.imageEvery = static_cast<int>(toNumber(option, value, 1));
+        else if (option == "--image-size") options.imageSize = static_cast<int>(toNumber(option, value, 0));
+        else if (option == "--metrics") options.metrics = value;
+        else if (option == "--metrics-every") options.metricsEvery = static_cast<int>(toNumber(option, value, 1));
+        else if (option == "--trace") options.trace = value;
+        else if (option == "--log-level") {
+            Log::parseLevel(value); // Valider le nom
+            options.logLevel = value;
+        }
+        else if (option == "--random") {
+            istringstream in(value);
+            if (!(in >> options.density) || !in.eof() || options.density < 0.0 || options.density > 1.0) {
+                throw runtime_error("Valeur invalide pour --random : " + value);
+            }
+            random = true;
+        }
+        else {
+            throw runtime_error("Option inconnue : " + option);
+        }
+    }
+
+    if ((options.rows > 0) != (options.cols > 0)) {
+        throw runtime_error("Les options --rows et --cols doivent être données ensemble.");
+    }
+    if (random && !options.input.empty()) {
+        throw runtime_error("Les options --random et --input sont incompatibles.");
+    }
+    if (options.engine != "flat") {
+        throw runtime_error("Moteur inconnu : " + options.engine + " (moteurs disponibles : flat)");
+    }
+    if (options.imageFormat != "png" && options.imageFormat != "ppm") {
+        throw runtime_error("Format d'image inconnu : " + options.imageFormat + " (png ou ppm)");
+    }
+    if (!options.save.empty() && !endsWith(options.save, ".rle") && !endsWith(options.save, ".mc") &&
+        !endsWith(options.save, ".golb")) {
+        throw runtime_error("Format de sauvegarde inconnu : " + options.save + " (.rle, .mc ou .golb)");
+    }
+    return options;
+}
+
+// Texte d'aide décrivant les options
+string HeadlessOptions::usage(const string& program) {
+    return "Utilisation : " + program + " [options]\n"
+           "Sans option, le jeu démarre en mode interactif.\n"
+           "\n"
+           "  -i, --input FICHIER     grille initiale (.rle, .mc, .golb, .delta ou texte) ou\n"
+           "                          trajectoire .golt reprise et prolongée (mêmes --rule et --toric)\n"
+           "  --rows N --cols N       dimensions de la grille (25 x 25 sans fichier)\n"
+           "  --rule REGLE            règle, par exemple B3/S23\n"
+           "  --toric                 bords opposés connectés\n"
+           "  --random DENSITE        remplissage aléatoire (entre 0 et 1, sans --input)\n"
+           "  --seed N                graine du remplissage aléatoire (1)\n"
+           "  -g, --generations N     nombre de générations (100)\n"
+           "  -t, --threads N         threads de mise à jour (1, 0 : selon le matériel)\n"
+           "  --engine NOM            moteur de simulation (flat)\n"
+           "  --until-stable          arrêter dès que la grille est stable\n"
+           "  --history N             états conservés pour l'annulation (1, 0 : illimité)\n"
+           "  --log FICHIER           journal de chaque génération (.delta : journal delta)\n"
+           "  --save FICHIER          état final (.rle, .mc ou .golb)\n"
+           "  --trajectory FICHIER    trajectoire sur disque\n"
+           "  --images PREFIXE        images des générations\n"
+           "  --image-format png|ppm  format des images (png)\n"
+           "  --image-every N         une image toutes les N générations (1)\n"
+           "  --image-size N          plus grande dimension des images (0 : un pixel par cellule)\n"
+           "  --metrics FICHIER       mesures de performance au format Prometheus\n"
+           "  --metrics-every MS      délai entre deux écritures des mesures (1000)\n"
+           "  --trace FICHIER         trace chronologique (JSON de Chrome, lisible dans Perfetto)\n"
+           "  --log-level NIVEAU      messages de diagnostic : debug, info, warning, error, off (info)\n"
+           "  -h, --help              afficher cette aide\n";
+}
+
+HeadlessInterface::HeadlessInterface(const HeadlessOptions& headlessOptions) : options(headlessOptions) {}
+
+// Exécute la simulation sans affichage, à pleine vitesse
+void HeadlessInterface::run(Grid& grid, int /*delay*/, int maxIterations) {
+    long long generations = maxIterations > 0 ? maxIterations : options.generations;
+
+    unique_ptr<OutputWriter> log;
+    if (!options.log.empty()) {
+        log.reset(new OutputWriter(options.log, endsWith(options.log, ".delta") ? OutputWriter::DELTA : OutputWriter::TEXTE));
+    }
+    unique_ptr<ImageExporter> images;
+    if (!options.images.empty()) {
+        images.reset(new ImageExporter(options.images, options.imageFormat == "ppm" ? ImageExporter::PPM : ImageExporter::PNG,
+                                       options.imageEvery, options.imageSize));
+        images->submit(grid.snapshot(), grid.getGeneration()); // État initial
+    }
+    if (!options.trajectory.empty()) {
+        grid.recordTrajectory(options.trajectory);
+    }
+    grid.setHistoryLimit(options.history);
+    shared_ptr<Metrics> metrics = grid.getMetrics();
+    if (!options.metrics.empty()) {
+        if (!metrics) {
+            metrics = make_shared<Metrics>();
+            grid.setMetrics(metrics);
+        }
+        metrics->startDump(options.metrics, options.metricsEvery);
+    }
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    long long computed = 0;
+    bool stable = false;
+    while (computed < generations) {
+        grid.update();
+        ++computed;
+        if (log || images) {
+            TRACE_SPAN("HeadlessInterface::write");
+            chrono::steady_clock::time_point written = chrono::steady_clock::now();
+            GridSnapshot snapshot = grid.snapshot();
+            if (log) log->write(snapshot, grid.getGeneration());
+            if (images) images->submit(snapshot, grid.getGeneration());
+            if (metrics) {
+                metrics->recordTime(Metrics::ENTREES_SORTIES, chrono::duration<double>(chrono::steady_clock::now() - written).count());
+            }
+        }
+        if (options.untilStable && grid.hasStableState()) {
+            stable = true;
+            break;
+        }
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    if (log && !log->close()) {
+        throw runtime_error("Erreur d'écriture du journal.");
+    }
+    if (images) {
+        images->finish();
+    }
+    if (endsWith(options.save, ".rle")) grid.saveRLE(options.save);
+    else if (endsWith(options.save, ".mc")) grid.saveMacrocell(options.save);
+    else if (endsWith(options.save, ".golb")) grid.saveBinary(options.save);
+    if (metrics && !options.metrics.empty()) {
+        metrics->stopDump(); // Dernière écriture avec toutes les générations
+    }
+
+    double cellsPerGeneration = static_cast<double>(grid.getRows()) * grid.getCols();
+    cout << "Générations calculées : " << computed << (stable ? " (état stable atteint)" : "") << endl;
+    cout << "Grille : " << grid.getRows() << " x " << grid.getCols() << ", règle " << grid.getRule().toString() << endl;
+    cout << "Durée de la simulation : " << seconds << " s" << endl;
+    if (seconds > 0.0) {
+        cout << "Débit : " << computed / seconds << " générations/s, "
+             << computed * cellsPerGeneration / seconds << " cellules/s" << endl;
+    }
+}
@@ -0,0 +1,76 @@
+// interfaces/Headless.h
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+#include "SimulationInterface.h"
+#include <string>
+
+/**
+ * @brief Options du mode sans affichage, lues sur la ligne de commande.
+ */
+struct HeadlessOptions {
+    std::string input; // Fichier initial (.rle, .mc, .golb, .delta, .golt ou texte)
+    int rows; // 0 : dimensions du fichier (25 sans fichier)
+    int cols;
+    std::string rule; // Vide : règle du fichier (B3/S23 par défaut)
+    bool toric;
+    double density; // Remplissage aléatoire (0 : aucun)
+    unsigned seed;
+    long long generations;
+    unsigned threads; // 0 : selon le matériel
+    std::string engine;
+    bool untilStable; // Arrêter dès que la grille est stable
+    std::size_t history; // États conservés pour l'annulation
+    std::string log; // Journal de chaque génération (.delta : journal delta, sinon texte)
+    std::string save; // État final (.rle, .mc ou .golb)
+    std::string trajectory; // Fichier de trajectoire
+    std::string images; // Préfixe des images
+    std::string imageFormat;
+    int imageEvery;
+    int imageSize;
+    std::string logLevel; // Niveau de journalisation (vide : inchangé)
+    std::string metrics; // Mesures au format Prometheus (vide : aucune)
+    int metricsEvery; // Millisecondes entre deux écritures des mesures
+    std::string trace; // Trace chronologique au format JSON de Chrome (vide : aucune)
+
+    HeadlessOptions();
+
+    /**
+     * @brief Lit les options de la ligne de commande.
+     *
+     * @throws std::runtime_error Si une option est inconnue ou sa valeur invalide.
+     */
+    static HeadlessOptions parse(int argc, char* argv[]);
+
+    /**
+     * @brief Texte d'aide décrivant les options.
+     */
+    static std::string usage(const std::string& program);
+};
+
+/**
+ * @brief Interface sans affichage pour les traitements par lots.
+ *
+ * La simulation tourne sans délai ni saisie ; les sorties (journal, images,
+ * trajectoire, état final) sont celles demandées dans les options. La durée
+ * et le débit sont affichés à la fin ; les mesures de performance (voir
+ * Metrics) peuvent aussi être écrites périodiquement dans un fichier.
+ */
+class HeadlessInterface : public SimulationInterface {
+public:
+    explicit HeadlessInterface(const HeadlessOptions& options);
+
+    /**
+     * @brief Exécute la simulation sans affichage.
+     *
+     * @param grid Référence vers la grille de simulation.
+     * @param delay Ignoré : la simulation tourne à pleine vitesse.
+     * @param maxIterations Nombre de générations (0 : celui des options).
+     */
+    void run(Grid& grid, int delay, int maxIterations) override;
+
+private:
+    HeadlessOptions options;
+};
+
+#endif // HEADLESS_H
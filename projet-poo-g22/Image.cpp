@@ -0,0 +1,277 @@
+// components/Image.cpp
+#include "Image.h"
+#include <cstdio>
+#include <cstdint>
+#include <stdexcept>
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+// Écriture bit à bit d'un flux deflate (bits de poids faible en premier)
+class BitWriter {
+public:
+    explicit BitWriter(vector<unsigned char>& output) : out(output), bits(0), count(0) {}
+
+    void put(uint32_t value, int length) {
+        bits |= static_cast<uint64_t>(value) << count;
+        count += length;
+        while (count >= 8) {
+            out.push_back(static_cast<unsigned char>(bits));
+            bits >>= 8;
+            count -= 8;
+        }
+    }
+
+    // Code de Huffman : écrit en commençant par le bit de poids fort
+    void putCode(uint32_t code, int length) {
+        uint32_t reversed = 0;
+        for (int i = 0; i < length; ++i) {
+            reversed |= ((code >> i) & 1) << (length - 1 - i);
+        }
+        put(reversed, length);
+    }
+
+    void flush() {
+        if (count > 0) {
+            out.push_back(static_cast<unsigned char>(bits));
+        }
+        bits = 0;
+        count = 0;
+    }
+
+private:
+    vector<unsigned char>& out;
+    uint64_t bits;
+    int count;
+};
+
+const int LENGTH_BASE[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                              35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+const int LENGTH_EXTRA[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                               3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+const int DISTANCE_BASE[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+const int DISTANCE_EXTRA[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+const size_t MAX_DISTANCE = 32768;
+const size_t MAX_MATCH = 258;
+
+// Symbole littéral/longueur avec les codes de Huffman fixes
+void putSymbol(BitWriter& writer, int symbol) {
+    if (symbol < 144) writer.putCode(0x30 + symbol, 8);
+    else if (symbol < 256) writer.putCode(0x190 + symbol - 144, 9);
+    else if (symbol < 280) writer.putCode(symbol - 256, 7);
+    else writer.putCode(0xC0 + symbol - 280, 8);
+}
+
+void putMatch(BitWriter& writer, size_t length, size_t distance) {
+    int l = 28;
+    while (LENGTH_BASE[l] > static_cast<int>(length)) --l;
+    putSymbol(writer, 257 + l);
+    writer.put(static_cast<uint32_t>(length - LENGTH_BASE[l]), LENGTH_EXTRA[l]);
+    int d = 29;
+    while (DISTANCE_BASE[d] > static_cast<int>(distance)) --d;
+    writer.putCode(static_cast<uint32_t>(d), 5);
+    writer.put(static_cast<uint32_t>(distance - DISTANCE_BASE[d]), DISTANCE_EXTRA[d]);
+}
+
+// Flux zlib : un bloc deflate à codes fixes. Les correspondances ne sont
+// cherchées qu'aux distances utiles pour une image (octet précédent, pixel
+// précédent, ligne précédente), ce qui suffit pour les grandes zones unies.
+vector<unsigned char> zlibCompress(const vector<unsigned char>& data, size_t stride) {
+    vector<unsigned char> out;
+    out.reserve(data.size() / 4 + 64);
+    out.push_back(0x78);
+    out.push_back(0x01);
+
+    BitWriter writer(out);
+    writer.put(1, 1); // Dernier bloc
+    writer.put(1, 2); // Codes fixes
+    const size_t distances[3] = { 1, 3, stride };
+    size_t i = 0;
+    while (i < data.size()) {
+        size_t bestLength = 0;
+        size_t bestDistance = 0;
+        for (size_t distance : distances) {
+            if (distance == 0 || distance > i || distance > MAX_DISTANCE) continue;
+            size_t limit = min(MAX_MATCH, data.size() - i);
+            size_t length = 0;
+            while (length < limit && data[i + length] == data[i + length - distance]) ++length;
+            if (length > bestLength) {
+                bestLength = length;
+                bestDistance = distance;
+            }
+        }
+        if (bestLength >= 3) {
+            putMatch(writer, bestLength, bestDistance);
+            i += bestLength;
+        }
+        else {
+            putSymbol(writer, data[i++]);
+        }
+    }
+    putSymbol(writer, 256); // Fin de bloc
+    writer.flush();
+
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for (unsigned char byte : data) {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    uint32_t adler = (b << 16) | a;
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<unsigned char>(adler >> shift));
+    }
+    return out;
+}
+
+uint32_t crc32(const unsigned char* data, size_t size, uint32_t crc) {
+    static uint32_t table[256];
+    static bool ready = [] {
+        for (uint32_t n = 0; n < 256; ++n) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[n] = c;
+        }
+        return true;
+    }();
+    (void)ready;
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+void putBigEndian(vector<unsigned char>& out, uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<unsigned char>(value >> shift));
+    }
+}
+
+void putChunk(vector<unsigned char>& out, const char type[4], const vector<unsigned char>& data) {
+    putBigEndian(out, static_cast<uint32_t>(data.size()));
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    putBigEndian(out, crc32(&out[start], out.size() - start, 0));
+}
+
+void writeFile(const string& filename, const unsigned char* data, size_t size) {
+    FILE* file = fopen(filename.c_str(), "wb");
+    if (!file) {
+        throw runtime_error("Impossible de créer le fichier image.");
+    }
+    bool ok = size == 0 || fwrite(data, size, 1, file) == 1;
+    ok = fclose(file) == 0 && ok;
+    if (!ok) {
+        throw runtime_error("Erreur d'écriture du fichier image.");
+    }
+}
+
+} // namespace
+
+Image::Image(int w, int h) : width(w), height(h), pixels(static_cast<size_t>(w) * h * 3, 0) {}
+
+// Dessine un instantané, chaque pixel étant la couleur moyenne d'un bloc de cellules
+Image Image::render(const GridSnapshot& snapshot, int scale) {
+    scale = max(1, scale);
+    Image image((snapshot.getCols() + scale - 1) / scale, (snapshot.getRows() + scale - 1) / scale);
+    renderRows(snapshot, scale, 0, image.height, image.pixels.data(), 3);
+    return image;
+}
+
+// Dessine les lignes de pixels [firstY, lastY) d'un instantané (moyenne des blocs de cellules)
+void Image::renderRows(const GridSnapshot& snapshot, int scale, int firstY, int lastY, unsigned char* out, int channels) {
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    int rows = snapshot.getRows();
+    int cols = snapshot.getCols();
+    scale = max(1, scale);
+    int imageWidth = (cols + scale - 1) / scale;
+
+    vector<unsigned> alive(imageWidth);
+    vector<unsigned> obstacles(imageWidth);
+    for (int y = firstY; y < lastY; ++y) {
+        fill(alive.begin(), alive.end(), 0u);
+        fill(obstacles.begin(), obstacles.end(), 0u);
+        int firstRow = y * scale;
+        int lastRow = min(rows, firstRow + scale);
+        for (int i = firstRow; i < lastRow; ++i) {
+            int offset = (i % tileSize) * tileSize;
+            for (int tc = 0; tc < snapshot.getTileCols(); ++tc) {
+                const GridSnapshot::TilePtr& tile = snapshot.getTile(i / tileSize, tc);
+                if (tile == GridSnapshot::emptyTile()) {
+                    continue; // Tuile vide : rien à compter
+                }
+                const unsigned char* cells = tile->cells + offset;
+                int left = tc * tileSize;
+                int width = min(tileSize, cols - left);
+                for (int j = 0; j < width; ++j) {
+                    if (cells[j] == VIVANT) ++alive[(left + j) / scale];
+                    else if (cells[j] == OBSTACLE) ++obstacles[(left + j) / scale];
+                }
+            }
+        }
+
+        unsigned char* pixel = out + static_cast<size_t>(y - firstY) * imageWidth * channels;
+        unsigned blockRows = static_cast<unsigned>(lastRow - firstRow);
+        for (int x = 0; x < imageWidth; ++x, pixel += channels) {
+            unsigned blockCols = static_cast<unsigned>(min(cols, (x + 1) * scale) - x * scale);
+            unsigned count = blockRows * blockCols;
+            // Vivante : blanc, obstacle : rouge, vide : noir
+            pixel[0] = static_cast<unsigned char>((255u * (alive[x] + obstacles[x]) + count / 2) / count);
+            pixel[1] = static_cast<unsigned char>((255u * alive[x] + count / 2) / count);
+            pixel[2] = pixel[1];
+            if (channels == 4) {
+                pixel[3] = 255;
+            }
+        }
+    }
+}
+
+// Enregistre l'image au format PPM binaire
+void Image::savePPM(const string& filename) const {
+    char header[64];
+    int length = snprintf(header, sizeof(header), "P6\n%d %d\n255\n", width, height);
+    vector<unsigned char> data(header, header + length);
+    data.insert(data.end(), pixels.begin(), pixels.end());
+    writeFile(filename, data.data(), data.size());
+}
+
+// Enregistre l'image au format PNG (RVB 8 bits, filtre « Up »)
+void Image::savePNG(const string& filename) const {
+    size_t rowBytes = static_cast<size_t>(width) * 3;
+    vector<unsigned char> scanlines;
+    scanlines.reserve((rowBytes + 1) * height);
+    for (int y = 0; y < height; ++y) {
+        const unsigned char* row = &pixels[y * rowBytes];
+        if (y == 0) {
+            scanlines.push_back(0); // Aucun filtre
+            scanlines.insert(scanlines.end(), row, row + rowBytes);
+            continue;
+        }
+        // Filtre « Up » : différence avec la ligne précédente
+        scanlines.push_back(2);
+        const unsigned char* above = row - rowBytes;
+        for (size_t i = 0; i < rowBytes; ++i) {
+            scanlines.push_back(static_cast<unsigned char>(row[i] - above[i]));
+        }
+    }
+
+    vector<unsigned char> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    vector<unsigned char> header;
+    putBigEndian(header, static_cast<uint32_t>(width));
+    putBigEndian(header, static_cast<uint32_t>(height));
+    header.push_back(8); // Bits par composante
+    header.push_back(2); // RVB
+    header.push_back(0); // Compression deflate
+    header.push_back(0); // Filtrage standard
+    header.push_back(0); // Sans entrelacement
+    putChunk(png, "IHDR", header);
+    putChunk(png, "IDAT", zlibCompress(scanlines, rowBytes + 1));
+    putChunk(png, "IEND", vector<unsigned char>());
+    writeFile(filename, png.data(), png.size());
+}
@@ -0,0 +1,75 @@
+// components/Image.h
+#ifndef IMAGE_H
+#define IMAGE_H
+
+#include "Snapshot.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Image RVB 8 bits produite à partir d'une grille, sans fenêtre SFML.
+ *
+ * Les couleurs sont celles de l'interface graphique : cellule vivante en
+ * blanc, obstacle en rouge, cellule vide en noir. Avec un facteur de
+ * réduction, chaque pixel est la moyenne des couleurs d'un bloc de
+ * facteur x facteur cellules, ce qui rend visibles les très grandes
+ * grilles sous forme de carte de densité.
+ *
+ * L'enregistrement se fait en PPM (P6) ou en PNG ; l'encodeur PNG est
+ * intégré (filtre « Up », compression deflate à codes fixes) et ne dépend
+ * d'aucune bibliothèque externe.
+ */
+class Image {
+public:
+    /**
+     * @brief Construit une image noire.
+     */
+    Image(int width, int height);
+
+    /**
+     * @brief Dessine un instantané de la grille.
+     *
+     * @param snapshot Instantané de la grille.
+     * @param scale Côté en cellules du bloc représenté par un pixel (1 : un pixel par cellule).
+     * @return Image Image de ceil(colonnes / scale) x ceil(lignes / scale) pixels.
+     */
+    static Image render(const GridSnapshot& snapshot, int scale = 1);
+
+    /**
+     * @brief Dessine une partie des lignes de pixels d'un instantané dans un tampon.
+     *
+     * @param snapshot Instantané de la grille.
+     * @param scale Côté en cellules du bloc représenté par un pixel.
+     * @param firstY Première ligne de pixels.
+     * @param lastY Ligne de pixels suivant la dernière.
+     * @param out Tampon de destination, à partir de la ligne firstY.
+     * @param channels 3 (R, V, B) ou 4 (R, V, B, alpha opaque).
+     */
+    static void renderRows(const GridSnapshot& snapshot, int scale, int firstY, int lastY, unsigned char* out, int channels);
+
+    /**
+     * @brief Enregistre l'image au format PPM binaire.
+     *
+     * @throws std::runtime_error Si le fichier ne peut pas être écrit.
+     */
+    void savePPM(const std::string& filename) const;
+
+    /**
+     * @brief Enregistre l'image au format PNG.
+     *
+     * @throws std::runtime_error Si le fichier ne peut pas être écrit.
+     */
+    void savePNG(const std::string& filename) const;
+
+    // Getters
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    const unsigned char* pixel(int x, int y) const { return &pixels[(static_cast<std::size_t>(y) * width + x) * 3]; }
+
+private:
+    int width;
+    int height;
+    std::vector<unsigned char> pixels; // R, V, B ligne par ligne
+};
+
+#endif // IMAGE_H
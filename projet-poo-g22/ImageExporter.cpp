@@ -0,0 +1,49 @@
+// components/ImageExporter.cpp
+#include "ImageExporter.h"
+#include "Image.h"
+#include <cstdio>
+#include <algorithm>
+
+using namespace std;
+
+// Prépare l'export
+ImageExporter::ImageExporter(const string& filePrefix, Format imageFormat, int every, int size, unsigned threads)
+    : prefix(filePrefix), format(imageFormat), interval(max(1, every)), maxSize(max(0, size)), pool(threads) {}
+
+// Facteur de réduction : la plus grande dimension de l'image ne dépasse pas maxSize
+int ImageExporter::scaleFor(int rows, int cols) const {
+    int largest = max(rows, cols);
+    if (maxSize == 0 || largest <= maxSize) {
+        return 1;
+    }
+    return (largest + maxSize - 1) / maxSize;
+}
+
+// Exporte la génération si son numéro est un multiple de l'intervalle
+bool ImageExporter::submit(const GridSnapshot& snapshot, long long generation) {
+    if (generation % interval != 0) {
+        return false;
+    }
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), "_%06lld.%s", generation, format == PNG ? "png" : "ppm");
+    string filename = prefix + suffix;
+    int scale = scaleFor(snapshot.getRows(), snapshot.getCols());
+    Format imageFormat = format;
+
+    // L'instantané partage ses tuiles : la copie capturée par la tâche est peu coûteuse
+    pool.submit([snapshot, scale, filename, imageFormat] {
+        Image image = Image::render(snapshot, scale);
+        if (imageFormat == PNG) {
+            image.savePNG(filename);
+        }
+        else {
+            image.savePPM(filename);
+        }
+    });
+    return true;
+}
+
+// Attend l'écriture de toutes les images demandées
+void ImageExporter::finish() {
+    pool.wait();
+}
@@ -0,0 +1,71 @@
+// components/ImageExporter.h
+#ifndef IMAGEEXPORTER_H
+#define IMAGEEXPORTER_H
+
+#include "Snapshot.h"
+#include "WorkerPool.h"
+#include <string>
+
+/**
+ * @brief Exporte une génération sur N sous forme d'images (PPM ou PNG).
+ *
+ * Prévu pour les exécutions sans affichage : les pixels sont calculés
+ * directement à partir des tuiles de l'instantané, sans fenêtre SFML. Le
+ * rendu et l'encodage sont confiés à un groupe de threads et se déroulent
+ * pendant que la simulation continue ; la file bornée du groupe limite la
+ * mémoire utilisée si l'encodage ne suit pas.
+ *
+ * Les fichiers sont nommés <préfixe>_<génération sur 6 chiffres>.<ext>.
+ */
+class ImageExporter {
+public:
+    /**
+     * @brief Format des images.
+     */
+    enum Format {
+        PPM,
+        PNG
+    };
+
+    /**
+     * @brief Prépare l'export.
+     *
+     * @param prefix Préfixe des noms de fichiers (peut contenir un dossier existant).
+     * @param format Format des images.
+     * @param interval Exporter une génération sur interval.
+     * @param maxSize Plus grande dimension des images en pixels (0 : un pixel par cellule) ;
+     *                au-delà, la grille est réduite par moyenne de densité.
+     * @param threads Nombre de threads d'encodage (0 : selon le matériel).
+     */
+    ImageExporter(const std::string& prefix, Format format, int interval = 1, int maxSize = 0, unsigned threads = 0);
+
+    /**
+     * @brief Exporte la génération si son numéro est un multiple de l'intervalle.
+     *
+     * @param snapshot Instantané de la grille.
+     * @param generation Numéro de la génération.
+     * @return true Si une image a été demandée.
+     */
+    bool submit(const GridSnapshot& snapshot, long long generation);
+
+    /**
+     * @brief Attend l'écriture de toutes les images demandées.
+     *
+     * @throws std::runtime_error Si une image n'a pas pu être écrite.
+     */
+    void finish();
+
+    /**
+     * @brief Facteur de réduction utilisé pour une grille donnée.
+     */
+    int scaleFor(int rows, int cols) const;
+
+private:
+    std::string prefix;
+    Format format;
+    int interval;
+    int maxSize;
+    WorkerPool pool;
+};
+
+#endif // IMAGEEXPORTER_H
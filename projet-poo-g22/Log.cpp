@@ -0,0 +1,148 @@
+// services/Log.cpp
+#include "Log.h"
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+
+atomic<int> Log::currentLevel(Log::INFO);
+
+namespace {
+
+const size_t RING_SIZE = 1024; // Puissance de deux
+const size_t MESSAGE_SIZE = 240; // Octets conservés par message
+const char* const LEVEL_NAMES[] = { "[debug] ", "[info] ", "[avertissement] ", "[erreur] " };
+
+/**
+ * @brief Anneau borné à producteurs multiples et consommateur unique, sans verrou.
+ *
+ * Chaque case porte un numéro de séquence : un producteur réserve une case
+ * en avançant head, la remplit puis publie le numéro ; le thread d'écriture
+ * lit les cases dans l'ordre et les rend aux producteurs.
+ */
+class LogRing {
+public:
+    LogRing() : head(0), tail(0), dropped(0), running(true) {
+        for (size_t i = 0; i < RING_SIZE; ++i) {
+            slots[i].sequence.store(i, memory_order_relaxed);
+        }
+        writer = thread(&LogRing::drain, this);
+    }
+
+    ~LogRing() {
+        running.store(false, memory_order_release);
+        writer.join();
+    }
+
+    bool push(int level, const string& message) {
+        size_t position = head.load(memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &slots[position & (RING_SIZE - 1)];
+            size_t sequence = slot->sequence.load(memory_order_acquire);
+            long long difference = static_cast<long long>(sequence) - static_cast<long long>(position);
+            if (difference == 0) {
+                if (head.compare_exchange_weak(position, position + 1, memory_order_relaxed)) break;
+            }
+            else if (difference < 0) {
+                dropped.fetch_add(1, memory_order_relaxed); // Anneau plein
+                return false;
+            }
+            else {
+                position = head.load(memory_order_relaxed);
+            }
+        }
+        slot->level = level;
+        slot->length = min(message.size(), MESSAGE_SIZE);
+        memcpy(slot->text, message.data(), slot->length);
+        slot->sequence.store(position + 1, memory_order_release);
+        return true;
+    }
+
+    void flush() {
+        size_t target = head.load(memory_order_acquire);
+        while (tail.load(memory_order_acquire) < target) {
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+    }
+
+private:
+    struct Slot {
+        atomic<size_t> sequence;
+        int level;
+        size_t length;
+        char text[MESSAGE_SIZE];
+    };
+
+    Slot slots[RING_SIZE];
+    atomic<size_t> head;
+    atomic<size_t> tail;
+    atomic<size_t> dropped;
+    atomic<bool> running;
+    thread writer;
+
+    // Thread d'écriture : vide l'anneau par lots, une écriture par lot
+    void drain() {
+        string buffer;
+        for (;;) {
+            bool stopping = !running.load(memory_order_acquire);
+            size_t position = tail.load(memory_order_relaxed);
+            for (;;) {
+                Slot& slot = slots[position & (RING_SIZE - 1)];
+                if (slot.sequence.load(memory_order_acquire) != position + 1) break;
+                buffer += LEVEL_NAMES[slot.level];
+                buffer.append(slot.text, slot.length);
+                buffer += '\n';
+                slot.sequence.store(position + RING_SIZE, memory_order_release);
+                ++position;
+            }
+            size_t lost = dropped.exchange(0, memory_order_relaxed);
+            if (lost > 0) {
+                buffer += "[avertissement] " + to_string(lost) + " message(s) de journal perdu(s)\n";
+            }
+            if (!buffer.empty()) {
+                fwrite(buffer.data(), 1, buffer.size(), stderr);
+                fflush(stderr);
+                buffer.clear();
+            }
+            tail.store(position, memory_order_release);
+            if (stopping) {
+                return; // Dernier passage après la demande d'arrêt
+            }
+            this_thread::sleep_for(chrono::milliseconds(2));
+        }
+    }
+};
+
+LogRing& ring() {
+    static LogRing instance; // Démarré au premier message activé
+    return instance;
+}
+
+} // namespace
+
+// Lit un nom de niveau
+Log::Level Log::parseLevel(const string& name) {
+    if (name == "debug") return DEBOGAGE;
+    if (name == "info") return INFO;
+    if (name == "warning") return AVERTISSEMENT;
+    if (name == "error") return ERREUR;
+    if (name == "off") return AUCUN;
+    throw runtime_error("Niveau de journalisation inconnu : " + name + " (debug, info, warning, error ou off)");
+}
+
+// Dépose un message dans l'anneau
+bool Log::write(Level level, const string& message) {
+    if (level < DEBOGAGE || level > ERREUR) {
+        return false;
+    }
+    return ring().push(level, message);
+}
+
+// Attend que tous les messages déposés aient été écrits
+void Log::flush() {
+    ring().flush();
+}
@@ -0,0 +1,88 @@
+// services/Log.h
+#ifndef LOG_H
+#define LOG_H
+
+#include <string>
+#include <sstream>
+#include <atomic>
+
+/**
+ * @brief Niveau minimal compilé : les messages de niveau inférieur disparaissent du binaire.
+ *
+ * 0 : débogage, 1 : information, 2 : avertissement, 3 : erreur, 4 : aucun message.
+ */
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL 0
+#endif
+
+/**
+ * @brief Journalisation par niveaux, sans blocage dans la boucle de simulation.
+ *
+ * Un message d'un niveau désactivé ne coûte qu'une comparaison (ou rien du
+ * tout sous LOG_MIN_LEVEL) : le texte n'est même pas construit. Un message
+ * activé est copié dans un anneau sans verrou puis écrit sur la sortie
+ * d'erreur par un thread dédié ; si l'anneau est plein, le message est
+ * abandonné et compté plutôt que de ralentir l'appelant.
+ *
+ * Utilisation : LOG_DEBUG("Génération " << numero);
+ */
+class Log {
+public:
+    enum Level {
+        DEBOGAGE = 0,
+        INFO = 1,
+        AVERTISSEMENT = 2,
+        ERREUR = 3,
+        AUCUN = 4
+    };
+
+    /**
+     * @brief Vérifie si un niveau est activé à l'exécution.
+     */
+    static bool enabled(Level level) { return level >= currentLevel.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Change le niveau minimal à l'exécution (INFO par défaut).
+     */
+    static void setLevel(Level level) { currentLevel.store(level, std::memory_order_relaxed); }
+
+    static Level getLevel() { return static_cast<Level>(currentLevel.load(std::memory_order_relaxed)); }
+
+    /**
+     * @brief Lit un nom de niveau (« debug », « info », « warning », « error », « off »).
+     *
+     * @throws std::runtime_error Si le nom est inconnu.
+     */
+    static Level parseLevel(const std::string& name);
+
+    /**
+     * @brief Dépose un message dans l'anneau (tronqué s'il est trop long).
+     *
+     * @return false Si l'anneau était plein et que le message a été abandonné.
+     */
+    static bool write(Level level, const std::string& message);
+
+    /**
+     * @brief Attend que tous les messages déposés aient été écrits.
+     */
+    static void flush();
+
+private:
+    static std::atomic<int> currentLevel;
+};
+
+#define LOG_AT(level, expression)                                          \
+    do {                                                                   \
+        if ((level) >= LOG_MIN_LEVEL && Log::enabled(level)) {             \
+            std::ostringstream logStream;                                  \
+            logStream << expression;                                       \
+            Log::write(level, logStream.str());                            \
+        }                                                                  \
+    } while (0)
+
+#define LOG_DEBUG(expression) LOG_AT(Log::DEBOGAGE, expression)
+#define LOG_INFO(expression) LOG_AT(Log::INFO, expression)
+#define LOG_WARNING(expression) LOG_AT(Log::AVERTISSEMENT, expression)
+#define LOG_ERROR(expression) LOG_AT(Log::ERREUR, expression)
+
+#endif // LOG_H
@@ -0,0 +1,297 @@
+// components/Macrocell.cpp
+#include "Macrocell.h"
+#include "MappedFile.h"
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#include <map>
+#include <cstring>
+
+using namespace std;
+
+namespace {
+
+const size_t FLUSH_SIZE = 1 << 16;
+
+// Ligne lue : niveau, nœud de l'arbre et, jusqu'au niveau 3, cellules dans un bloc 8 x 8
+struct Entry {
+    int level;
+    Quadtree::NodeId id;
+    uint64_t alive;
+    uint64_t obstacles;
+};
+
+bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+bool readNumber(const char*& p, const char* end, long long& value) {
+    while (p < end && isBlank(*p)) ++p;
+    if (p == end || *p < '0' || *p > '9') return false;
+    value = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        value = value * 10 + (*p++ - '0');
+        if (value > 0xFFFFFFFFll) return false;
+    }
+    return true;
+}
+
+void appendNumber(string& out, unsigned long long value) {
+    char digits[24];
+    int n = 0;
+    do {
+        digits[n++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (n > 0) out += digits[--n];
+}
+
+// Parcours en profondeur : chaque nœud accessible une seule fois, enfants avant parents
+void collect(const Quadtree& tree, Quadtree::NodeId id, vector<unsigned char>& visited, vector<Quadtree::NodeId>& order) {
+    if (id == Quadtree::EMPTY || visited[id]) return;
+    visited[id] = 1;
+    const Quadtree::Node& node = tree.getNode(id);
+    if (node.level > Quadtree::LEAF_LEVEL) {
+        for (int k = 0; k < 4; ++k) {
+            collect(tree, node.child[k], visited, order);
+        }
+    }
+    order.push_back(id);
+}
+
+// Écriture d'une ligne de nœud « k a b c d »
+void appendNode(string& out, int level, const uint32_t child[4]) {
+    appendNumber(out, static_cast<unsigned long long>(level));
+    for (int k = 0; k < 4; ++k) {
+        out += ' ';
+        appendNumber(out, child[k]);
+    }
+    out += '\n';
+}
+
+} // namespace
+
+// Lit un fichier Macrocell
+Quadtree Macrocell::read(const string& filename, Rule& rule) {
+    MappedFile file;
+    file.open(filename);
+    return parse(file.data(), file.size(), rule);
+}
+
+// Analyse un contenu Macrocell en mémoire
+Quadtree Macrocell::parse(const char* data, size_t size, Rule& rule) {
+    const char* p = data;
+    const char* end = data + size;
+    Quadtree tree;
+    vector<Entry> entries;
+    entries.reserve(size / 16);
+    bool header = false;
+
+    while (p < end) {
+        const char* lineEnd = static_cast<const char*>(memchr(p, '\n', static_cast<size_t>(end - p)));
+        if (!lineEnd) lineEnd = end;
+        const char* line = p;
+        p = lineEnd < end ? lineEnd + 1 : end;
+        while (line < lineEnd && isBlank(*line)) ++line;
+        if (line == lineEnd) continue;
+
+        if (!header) {
+            if (lineEnd - line < 4 || memcmp(line, "[M2]", 4) != 0) {
+                throw runtime_error("En-tête Macrocell manquant.");
+            }
+            header = true;
+            continue;
+        }
+
+        char first = *line;
+        if (first == '#') {
+            if (lineEnd - line > 2 && line[1] == 'R') {
+                const char* value = line + 2;
+                const char* valueEnd = lineEnd;
+                while (value < valueEnd && isBlank(*value)) ++value;
+                while (valueEnd > value && isBlank(valueEnd[-1])) --valueEnd;
+                rule = Rule::parse(string(value, valueEnd));
+            }
+            continue; // Autres en-têtes (#G, #C, ...) ignorés
+        }
+
+        Entry entry = {};
+        if (first == '.' || first == '*' || first == '$') {
+            // Feuille 8 x 8 à deux états
+            int r = 0;
+            int c = 0;
+            for (const char* q = line; q < lineEnd && !isBlank(*q); ++q) {
+                if (*q == '$') {
+                    ++r;
+                    c = 0;
+                    continue;
+                }
+                if ((*q != '.' && *q != '*') || r >= 8 || c >= 8) {
+                    throw runtime_error("Feuille Macrocell invalide.");
+                }
+                if (*q == '*') entry.alive |= uint64_t(1) << (r * 8 + c);
+                ++c;
+            }
+            entry.level = Quadtree::LEAF_LEVEL;
+            entry.id = tree.leaf(entry.alive, 0);
+            entries.push_back(entry);
+            continue;
+        }
+
+        long long level = 0;
+        long long child[4];
+        const char* q = line;
+        if (!readNumber(q, lineEnd, level) || !readNumber(q, lineEnd, child[0]) || !readNumber(q, lineEnd, child[1]) ||
+            !readNumber(q, lineEnd, child[2]) || !readNumber(q, lineEnd, child[3])) {
+            throw runtime_error("Ligne Macrocell invalide.");
+        }
+        if (level < 1 || level > Quadtree::MAX_LEVEL) {
+            throw runtime_error("Niveau Macrocell hors limites.");
+        }
+        entry.level = static_cast<int>(level);
+
+        if (level == 1) {
+            // Nœud multi-états 2 x 2 : 0 mort, 1 vivant, 2 obstacle
+            static const int BITS[4] = { 0, 1, 8, 9 };
+            for (int k = 0; k < 4; ++k) {
+                if (child[k] > 2) throw runtime_error("État Macrocell non pris en charge.");
+                if (child[k] == 1) entry.alive |= uint64_t(1) << BITS[k];
+                if (child[k] == 2) entry.obstacles |= uint64_t(1) << BITS[k];
+            }
+            entries.push_back(entry);
+            continue;
+        }
+
+        Quadtree::NodeId ids[4];
+        for (int k = 0; k < 4; ++k) {
+            if (child[k] > static_cast<long long>(entries.size())) {
+                throw runtime_error("Référence Macrocell vers une ligne absente.");
+            }
+            ids[k] = Quadtree::EMPTY;
+            if (child[k] == 0) continue;
+            const Entry& sub = entries[static_cast<size_t>(child[k] - 1)];
+            if (sub.level != level - 1) {
+                throw runtime_error("Niveau Macrocell incohérent.");
+            }
+            ids[k] = sub.id;
+            if (level <= Quadtree::LEAF_LEVEL) {
+                int half = 1 << (level - 1); // Côté d'un enfant dans la feuille 8 x 8
+                int shift = (k >> 1) * half * 8 + (k & 1) * half;
+                entry.alive |= sub.alive << shift;
+                entry.obstacles |= sub.obstacles << shift;
+            }
+        }
+        if (level == Quadtree::LEAF_LEVEL) {
+            entry.id = tree.leaf(entry.alive, entry.obstacles);
+        }
+        else if (level > Quadtree::LEAF_LEVEL) {
+            entry.id = tree.node(entry.level, ids[0], ids[1], ids[2], ids[3]);
+        }
+        entries.push_back(entry);
+    }
+
+    if (!header) {
+        throw runtime_error("En-tête Macrocell manquant.");
+    }
+    if (!entries.empty()) {
+        // La racine est la dernière ligne ; un motif plus petit qu'une feuille devient une feuille
+        const Entry& root = entries.back();
+        if (root.level < Quadtree::LEAF_LEVEL) {
+            tree.setRoot(tree.leaf(root.alive, root.obstacles), Quadtree::LEAF_LEVEL);
+        }
+        else {
+            tree.setRoot(root.id, root.level);
+        }
+    }
+    return tree;
+}
+
+// Écrit un arbre dans un fichier Macrocell
+void Macrocell::write(const string& filename, const Quadtree& tree, const Rule& rule) {
+    ofstream file(filename, ios::binary | ios::trunc);
+    if (!file.is_open()) {
+        throw runtime_error("Impossible de créer le fichier Macrocell.");
+    }
+    write(file, tree, rule);
+}
+
+// Écrit un arbre au format Macrocell dans un flux
+void Macrocell::write(ostream& out, const Quadtree& tree, const Rule& rule) {
+    string buffer = "[M2] (jeu-de-la-vie-poo)\n#R " + rule.toString() + "\n";
+
+    vector<unsigned char> visited(tree.getNodeCount(), 0);
+    vector<Quadtree::NodeId> order;
+    collect(tree, tree.getRoot(), visited, order);
+    bool multistate = false;
+    for (Quadtree::NodeId id : order) {
+        const Quadtree::Node& node = tree.getNode(id);
+        if (node.level == Quadtree::LEAF_LEVEL && node.obstacles) {
+            multistate = true;
+            break;
+        }
+    }
+
+    vector<uint32_t> lineOf(tree.getNodeCount(), 0);
+    uint32_t lines = 0;
+    uint32_t blocks2x2[256] = {}; // Multi-états : lignes des nœuds de niveau 1 (par états)
+    map<vector<uint32_t>, uint32_t> blocks4x4; // Multi-états : lignes des nœuds de niveau 2 (par enfants)
+
+    for (Quadtree::NodeId id : order) {
+        const Quadtree::Node& node = tree.getNode(id);
+        if (node.level > Quadtree::LEAF_LEVEL) {
+            uint32_t child[4];
+            for (int k = 0; k < 4; ++k) child[k] = lineOf[node.child[k]];
+            appendNode(buffer, node.level, child);
+        }
+        else if (!multistate) {
+            // Feuille : « . » et « * », lignes terminées par « $ », zéros de fin omis
+            for (int r = 0; r < 8; ++r) {
+                uint64_t rest = node.alive >> (r * 8);
+                if (!rest) break;
+                uint64_t row = rest & 0xFF;
+                for (int c = 0; row >> c; ++c) {
+                    buffer += ((row >> c) & 1) ? '*' : '.';
+                }
+                buffer += '$';
+            }
+            buffer += '\n';
+        }
+        else {
+            // Feuille multi-états : nœuds de niveau 1 et 2, puis nœud de niveau 3
+            uint32_t level2[4];
+            for (int q2 = 0; q2 < 4; ++q2) {
+                vector<uint32_t> level1(4);
+                for (int q1 = 0; q1 < 4; ++q1) {
+                    int r0 = (q2 >> 1) * 4 + (q1 >> 1) * 2;
+                    int c0 = (q2 & 1) * 4 + (q1 & 1) * 2;
+                    uint32_t states[4];
+                    int key = 0;
+                    for (int k = 0; k < 4; ++k) {
+                        int bit = (r0 + (k >> 1)) * 8 + c0 + (k & 1);
+                        states[k] = ((node.obstacles >> bit) & 1) ? 2 : static_cast<uint32_t>((node.alive >> bit) & 1);
+                        key |= static_cast<int>(states[k]) << (2 * k);
+                    }
+                    if (key != 0 && blocks2x2[key] == 0) {
+                        appendNode(buffer, 1, states);
+                        blocks2x2[key] = ++lines;
+                    }
+                    level1[q1] = blocks2x2[key];
+                }
+                uint32_t& line = blocks4x4[level1];
+                if (line == 0 && (level1[0] | level1[1] | level1[2] | level1[3])) {
+                    appendNode(buffer, 2, level1.data());
+                    line = ++lines;
+                }
+                level2[q2] = line;
+            }
+            appendNode(buffer, 3, level2);
+        }
+        lineOf[id] = ++lines;
+
+        if (buffer.size() >= FLUSH_SIZE) {
+            out.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+    out.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+}
@@ -0,0 +1,66 @@
+// components/Macrocell.h
+#ifndef MACROCELL_H
+#define MACROCELL_H
+
+#include "Quadtree.h"
+#include "Rule.h"
+#include <string>
+#include <ostream>
+#include <cstddef>
+
+/**
+ * @brief Lecture et écriture du format Macrocell (« [M2] », fichiers .mc).
+ *
+ * Chaque ligne décrit un nœud d'arbre quaternaire : une feuille de 8 x 8
+ * cellules (« . » morte, « * » vivante, « $ » fin de ligne) ou un nœud
+ * « k nw ne sw se » de niveau k dont les enfants sont les numéros des
+ * lignes précédentes (0 pour un carré vide). Les nœuds étant partagés, la
+ * lecture d'un motif immense mais répétitif ne dépend que du nombre de
+ * lignes du fichier, pas de la surface du motif.
+ *
+ * Les obstacles, absents du format à deux états, sont écrits avec la
+ * variante multi-états (nœuds « 1 a b c d », état 2 pour un obstacle),
+ * uniquement si le motif en contient.
+ */
+class Macrocell {
+public:
+    /**
+     * @brief Lit un fichier Macrocell.
+     *
+     * @param filename Nom du fichier.
+     * @param rule Règle lue dans l'en-tête « #R » (inchangée si absente).
+     * @return Quadtree Arbre du motif.
+     * @throws std::runtime_error Si le fichier ne peut pas être ouvert ou est invalide.
+     */
+    static Quadtree read(const std::string& filename, Rule& rule);
+
+    /**
+     * @brief Analyse un contenu Macrocell en mémoire.
+     *
+     * @param data Début du contenu.
+     * @param size Taille du contenu en octets.
+     * @param rule Règle lue dans l'en-tête « #R » (inchangée si absente).
+     * @return Quadtree Arbre du motif.
+     * @throws std::runtime_error Si le contenu est invalide.
+     */
+    static Quadtree parse(const char* data, std::size_t size, Rule& rule);
+
+    /**
+     * @brief Écrit un arbre dans un fichier Macrocell.
+     *
+     * @param filename Nom du fichier.
+     * @param tree Arbre du motif.
+     * @param rule Règle écrite dans l'en-tête.
+     * @throws std::runtime_error Si le fichier ne peut pas être créé.
+     */
+    static void write(const std::string& filename, const Quadtree& tree, const Rule& rule);
+
+    /**
+     * @brief Écrit un arbre au format Macrocell dans un flux.
+     *
+     * Chaque nœud accessible depuis la racine est écrit une seule fois.
+     */
+    static void write(std::ostream& out, const Quadtree& tree, const Rule& rule);
+};
+
+#endif // MACROCELL_H
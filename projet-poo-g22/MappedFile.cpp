@@ -0,0 +1,112 @@
+// components/MappedFile.cpp
+#include "MappedFile.h"
+#include <stdexcept>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+#ifdef _WIN32
+
+MappedFile::MappedFile() : begin(nullptr), length(0), fileHandle(nullptr), mappingHandle(nullptr) {}
+
+// Projette un fichier en mémoire
+void MappedFile::open(const string& filename) {
+    close();
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw runtime_error("Impossible d'ouvrir le fichier.");
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        throw runtime_error("Impossible de lire la taille du fichier.");
+    }
+    fileHandle = file;
+    length = static_cast<size_t>(fileSize.QuadPart);
+    if (length == 0) {
+        return; // Un fichier vide ne peut pas être projeté
+    }
+    mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mappingHandle == nullptr) {
+        close();
+        throw runtime_error("Impossible de projeter le fichier en mémoire.");
+    }
+    begin = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (begin == nullptr) {
+        close();
+        throw runtime_error("Impossible de projeter le fichier en mémoire.");
+    }
+}
+
+// Libère la projection
+void MappedFile::close() {
+    if (begin) {
+        UnmapViewOfFile(begin);
+    }
+    if (mappingHandle) {
+        CloseHandle(mappingHandle);
+    }
+    if (fileHandle) {
+        CloseHandle(fileHandle);
+    }
+    begin = nullptr;
+    length = 0;
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+}
+
+#else
+
+MappedFile::MappedFile() : begin(nullptr), length(0) {}
+
+// Projette un fichier en mémoire
+void MappedFile::open(const string& filename) {
+    close();
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw runtime_error("Impossible d'ouvrir le fichier.");
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw runtime_error("Impossible de lire la taille du fichier.");
+    }
+    length = static_cast<size_t>(info.st_size);
+    if (length > 0) {
+        void* address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+            ::close(fd);
+            length = 0;
+            throw runtime_error("Impossible de projeter le fichier en mémoire.");
+        }
+        madvise(address, length, MADV_SEQUENTIAL);
+        begin = static_cast<const char*>(address);
+    }
+    ::close(fd); // La projection reste valide après la fermeture du descripteur
+}
+
+// Libère la projection
+void MappedFile::close() {
+    if (begin) {
+        munmap(const_cast<char*>(begin), length);
+    }
+    begin = nullptr;
+    length = 0;
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+    close();
+}
@@ -0,0 +1,54 @@
+// components/MappedFile.h
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <string>
+#include <cstddef>
+
+/**
+ * @brief Projection en mémoire d'un fichier en lecture seule.
+ *
+ * Utilise mmap sous POSIX et CreateFileMapping sous Windows. Le contenu est
+ * accessible directement sans copie tant que l'objet est ouvert.
+ */
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Projette un fichier en mémoire (ferme la projection précédente).
+     *
+     * @param filename Nom du fichier.
+     * @throws std::runtime_error Si le fichier ne peut pas être ouvert ou projeté.
+     */
+    void open(const std::string& filename);
+
+    /**
+     * @brief Libère la projection.
+     */
+    void close();
+
+    /**
+     * @brief Début du contenu projeté (nullptr si le fichier est vide).
+     */
+    const char* data() const { return begin; }
+
+    /**
+     * @brief Taille du contenu projeté en octets.
+     */
+    std::size_t size() const { return length; }
+
+private:
+    const char* begin;
+    std::size_t length;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+};
+
+#endif // MAPPEDFILE_H
@@ -0,0 +1,192 @@
+// components/Metrics.cpp
+#include "Metrics.h"
+#include "Log.h"
+#include <stdexcept>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+using namespace std;
+
+namespace {
+
+const double FIRST_BOUND = 10e-6; // Première borne des histogrammes (10 µs)
+const char PREFIX[] = "jeu_de_la_vie_";
+
+void appendFormat(string& text, const char* format, double value) {
+    char digits[64];
+    int length = snprintf(digits, sizeof(digits), format, value);
+    text.append(digits, static_cast<size_t>(length));
+}
+
+// Décrit une mesure (textes en ASCII : le format Prometheus est en UTF-8, les sources en Windows-1252)
+void appendHeader(string& text, const char* name, const char* type, const char* help) {
+    text += "# HELP ";
+    text += PREFIX;
+    text += name;
+    text += ' ';
+    text += help;
+    text += "\n# TYPE ";
+    text += PREFIX;
+    text += name;
+    text += ' ';
+    text += type;
+    text += '\n';
+}
+
+void appendValue(string& text, const char* name, const char* type, const char* help, double value) {
+    appendHeader(text, name, type, help);
+    text += PREFIX;
+    text += name;
+    appendFormat(text, " %.17g\n", value);
+}
+
+void appendHistogram(string& text, const char* name, const char* help, const Metrics::Histogram& histogram) {
+    appendHeader(text, name, "histogram", help);
+    uint64_t cumulative = 0;
+    for (int k = 0; k <= Metrics::BUCKETS; ++k) {
+        cumulative += histogram.counts[k];
+        text += PREFIX;
+        text += name;
+        if (k < Metrics::BUCKETS) {
+            appendFormat(text, "_bucket{le=\"%g\"}", Metrics::bucketBound(k));
+        }
+        else {
+            text += "_bucket{le=\"+Inf\"}";
+        }
+        appendFormat(text, " %.0f\n", static_cast<double>(cumulative));
+    }
+    text += PREFIX;
+    text += name;
+    appendFormat(text, "_sum %.17g\n", histogram.sum);
+    text += PREFIX;
+    text += name;
+    appendFormat(text, "_count %.0f\n", static_cast<double>(histogram.count));
+}
+
+void add(Metrics::Histogram& histogram, double seconds) {
+    int k = 0;
+    while (k < Metrics::BUCKETS && seconds > Metrics::bucketBound(k)) {
+        ++k;
+    }
+    ++histogram.counts[k];
+    ++histogram.count;
+    histogram.sum += seconds;
+}
+
+} // namespace
+
+Metrics::Histogram::Histogram() : count(0), sum(0.0) {
+    memset(counts, 0, sizeof(counts));
+}
+
+Metrics::Values::Values()
+    : generations(0), births(0), deaths(0), population(0), cellsPerSecond(0.0), historyBytes(0) {}
+
+Metrics::Metrics() : dumpStopping(false), dumpInterval(1000) {}
+
+Metrics::~Metrics() {
+    stopDump();
+}
+
+double Metrics::bucketBound(int index) {
+    return FIRST_BOUND * static_cast<double>(1u << index);
+}
+
+// Enregistre une génération calculée
+void Metrics::recordGeneration(const GenerationStats& stats, long long cells, double seconds, size_t historyBytes) {
+    lock_guard<mutex> lock(valuesMutex);
+    ++values.generations;
+    values.births += stats.births;
+    values.deaths += stats.deaths;
+    values.population = stats.population;
+    values.cellsPerSecond = seconds > 0.0 ? cells / seconds : 0.0;
+    values.historyBytes = historyBytes;
+    add(values.timers[PAS], seconds);
+}
+
+// Enregistre une durée d'affichage ou d'entrées-sorties
+void Metrics::recordTime(Timer timer, double seconds) {
+    lock_guard<mutex> lock(valuesMutex);
+    add(values.timers[timer], seconds);
+}
+
+Metrics::Values Metrics::read() const {
+    lock_guard<mutex> lock(valuesMutex);
+    return values;
+}
+
+// Met en forme les valeurs au format texte de Prometheus
+string Metrics::toPrometheus() const {
+    Values current = read();
+    string text;
+    appendValue(text, "generations_total", "counter", "Generations calculees.", static_cast<double>(current.generations));
+    appendValue(text, "births_total", "counter", "Cellules nees.", static_cast<double>(current.births));
+    appendValue(text, "deaths_total", "counter", "Cellules mortes.", static_cast<double>(current.deaths));
+    appendValue(text, "population", "gauge", "Cellules vivantes a la derniere generation.", static_cast<double>(current.population));
+    appendValue(text, "cells_per_second", "gauge", "Cellules calculees par seconde a la derniere generation.", current.cellsPerSecond);
+    appendValue(text, "history_bytes", "gauge", "Memoire des tuiles de l'historique d'annulation.", static_cast<double>(current.historyBytes));
+    appendHistogram(text, "step_seconds", "Duree du calcul d'une generation.", current.timers[PAS]);
+    appendHistogram(text, "render_seconds", "Duree de l'affichage d'une image.", current.timers[RENDU]);
+    appendHistogram(text, "io_seconds", "Duree des ecritures d'une generation.", current.timers[ENTREES_SORTIES]);
+    return text;
+}
+
+// Écrit les valeurs dans un fichier temporaire puis le renomme
+void Metrics::writePrometheus(const string& filename) const {
+    string text = toPrometheus();
+    string temporary = filename + ".tmp";
+    FILE* file = fopen(temporary.c_str(), "wb");
+    if (!file) {
+        throw runtime_error("Impossible de créer le fichier de mesures : " + filename);
+    }
+    bool written = fwrite(text.data(), 1, text.size(), file) == text.size();
+    written = fclose(file) == 0 && written;
+    if (written && rename(temporary.c_str(), filename.c_str()) != 0) {
+        // Sous Windows, rename ne remplace pas un fichier existant
+        remove(filename.c_str());
+        written = rename(temporary.c_str(), filename.c_str()) == 0;
+    }
+    if (!written) {
+        remove(temporary.c_str());
+        throw runtime_error("Impossible d'écrire le fichier de mesures : " + filename);
+    }
+}
+
+// Démarre le thread d'écriture périodique
+void Metrics::startDump(const string& filename, int intervalMs) {
+    stopDump();
+    dumpFile = filename;
+    dumpInterval = intervalMs > 0 ? intervalMs : 1;
+    dumpStopping = false;
+    dumper = thread(&Metrics::runDump, this);
+}
+
+// Arrête le thread d'écriture après une dernière écriture
+void Metrics::stopDump() {
+    if (!dumper.joinable()) {
+        return;
+    }
+    {
+        lock_guard<mutex> lock(dumpMutex);
+        dumpStopping = true;
+    }
+    dumpWake.notify_all();
+    dumper.join();
+}
+
+void Metrics::runDump() {
+    unique_lock<mutex> lock(dumpMutex);
+    bool stopping = false;
+    while (!stopping) {
+        stopping = dumpWake.wait_for(lock, chrono::milliseconds(dumpInterval), [this] { return dumpStopping; });
+        lock.unlock();
+        try {
+            writePrometheus(dumpFile);
+        }
+        catch (const runtime_error& e) {
+            LOG_WARNING(e.what());
+        }
+        lock.lock();
+    }
+}
@@ -0,0 +1,169 @@
+// components/Metrics.h
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Bilan d'une génération, calculé par la boucle de mise à jour.
+ */
+struct GenerationStats {
+    long long population; // Cellules vivantes après la génération
+    long long births; // Cellules devenues vivantes
+    long long deaths; // Cellules vivantes devenues vides
+
+    GenerationStats() : population(0), births(0), deaths(0) {}
+
+    GenerationStats& operator+=(const GenerationStats& other) {
+        population += other.population;
+        births += other.births;
+        deaths += other.deaths;
+        return *this;
+    }
+};
+
+/**
+ * @brief Mesures de performance de la simulation et des interfaces.
+ *
+ * La grille enregistre une fois par génération la durée du calcul, son
+ * bilan (GenerationStats) et la mémoire de l'historique ; les interfaces
+ * enregistrent la durée de l'affichage et des entrées-sorties de chaque
+ * image. Les bilans sont cumulés par chaque thread de calcul dans ses
+ * propres variables puis additionnés une fois la génération terminée : la
+ * boucle de mise à jour n'utilise ni verrou ni opération atomique, et
+ * chaque enregistrement ne prend qu'un verrou.
+ *
+ * Les valeurs sont lues par read() ou écrites au format texte de
+ * Prometheus, à la demande (writePrometheus) ou périodiquement par un
+ * thread dédié (startDump).
+ */
+class Metrics {
+public:
+    /**
+     * @brief Durées mesurées, chacune dans un histogramme.
+     */
+    enum Timer {
+        PAS, // Calcul d'une génération
+        RENDU, // Affichage d'une image
+        ENTREES_SORTIES // Écritures d'une génération (journal, images, fichiers)
+    };
+    static const int TIMERS = 3;
+
+    static const int BUCKETS = 20; // Bornes de 10 µs à 10 µs x 2^19 (environ 5 s), puis +Inf
+
+    /**
+     * @brief Histogramme de durées (bornes exponentielles, voir bucketBound).
+     */
+    struct Histogram {
+        std::uint64_t counts[BUCKETS + 1]; // Mesures par intervalle (non cumulées), la dernière au-delà de toutes les bornes
+        std::uint64_t count; // Nombre de mesures
+        double sum; // Somme des durées en secondes
+
+        Histogram();
+    };
+
+    /**
+     * @brief Valeurs lues à un instant donné.
+     */
+    struct Values {
+        long long generations; // Générations calculées
+        long long births; // Naissances cumulées
+        long long deaths; // Morts cumulées
+        long long population; // Cellules vivantes à la dernière génération
+        double cellsPerSecond; // Débit de la dernière génération
+        std::size_t historyBytes; // Mémoire des tuiles de l'historique
+        Histogram timers[TIMERS];
+
+        Values();
+    };
+
+    Metrics();
+
+    /**
+     * @brief Arrête l'écriture périodique (voir stopDump).
+     */
+    ~Metrics();
+
+    Metrics(const Metrics&) = delete;
+    Metrics& operator=(const Metrics&) = delete;
+
+    /**
+     * @brief Enregistre une génération calculée.
+     *
+     * @param stats Bilan de la génération.
+     * @param cells Nombre de cellules de la grille.
+     * @param seconds Durée du calcul.
+     * @param historyBytes Mémoire des tuiles de l'historique.
+     */
+    void recordGeneration(const GenerationStats& stats, long long cells, double seconds, std::size_t historyBytes);
+
+    /**
+     * @brief Enregistre une durée d'affichage ou d'entrées-sorties.
+     *
+     * @param timer Histogramme concerné.
+     * @param seconds Durée mesurée.
+     */
+    void recordTime(Timer timer, double seconds);
+
+    /**
+     * @brief Retourne une copie cohérente des valeurs.
+     */
+    Values read() const;
+
+    /**
+     * @brief Met en forme les valeurs au format texte de Prometheus.
+     */
+    std::string toPrometheus() const;
+
+    /**
+     * @brief Écrit les valeurs au format Prometheus dans un fichier.
+     *
+     * Le fichier est d'abord écrit sous un nom temporaire puis renommé : un
+     * lecteur ne voit jamais de fichier à moitié écrit.
+     *
+     * @param filename Nom du fichier.
+     * @throws std::runtime_error Si le fichier ne peut pas être écrit.
+     */
+    void writePrometheus(const std::string& filename) const;
+
+    /**
+     * @brief Démarre l'écriture périodique des valeurs dans un fichier.
+     *
+     * Une écriture en cours est d'abord arrêtée. Les erreurs d'écriture sont
+     * signalées dans le journal sans arrêter la simulation.
+     *
+     * @param filename Nom du fichier.
+     * @param intervalMs Délai entre deux écritures en millisecondes.
+     */
+    void startDump(const std::string& filename, int intervalMs = 1000);
+
+    /**
+     * @brief Arrête l'écriture périodique après une dernière écriture.
+     */
+    void stopDump();
+
+    /**
+     * @brief Borne supérieure (en secondes) de l'intervalle index des histogrammes.
+     */
+    static double bucketBound(int index);
+
+private:
+    mutable std::mutex valuesMutex;
+    Values values;
+
+    std::thread dumper;
+    std::mutex dumpMutex;
+    std::condition_variable dumpWake;
+    bool dumpStopping;
+    std::string dumpFile;
+    int dumpInterval;
+
+    void runDump();
+};
+
+#endif // METRICS_H
@@ -0,0 +1,207 @@
+// components/OutputWriter.cpp
+#include "OutputWriter.h"
+#include "Trace.h"
+#include <stdexcept>
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+const size_t FLUSH_SIZE = 4 << 20; // Taille des blocs écrits sur le disque
+const char SEPARATOR[] = "-----------------------\n";
+const char TOKENS[4] = { '0', '1', 'X', '0' }; // VIDE, VIVANT, OBSTACLE, MORT
+
+void appendNumber(string& buffer, long long value) {
+    char digits[24];
+    int length = snprintf(digits, sizeof(digits), "%lld", value);
+    buffer.append(digits, static_cast<size_t>(length));
+}
+
+// Écrit les cellules ligne par ligne (« 1 », « X » ou « 0 » par cellule)
+void appendRows(const GridSnapshot& snapshot, string& buffer) {
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    int rows = snapshot.getRows();
+    int cols = snapshot.getCols();
+
+    size_t position = buffer.size();
+    buffer.resize(position + static_cast<size_t>(rows) * (2 * cols + 1));
+    char* out = &buffer[position];
+    for (int i = 0; i < rows; ++i) {
+        int tileRow = i / tileSize;
+        int offset = (i % tileSize) * tileSize;
+        for (int tc = 0; tc < snapshot.getTileCols(); ++tc) {
+            const unsigned char* cells = snapshot.getTile(tileRow, tc)->cells + offset;
+            int width = min(tileSize, cols - tc * tileSize);
+            for (int j = 0; j < width; ++j) {
+                *out++ = TOKENS[cells[j] & 3];
+                *out++ = ' ';
+            }
+        }
+        *out++ = '\n';
+    }
+}
+
+} // namespace
+
+// Ouvre le fichier (tronqué) et démarre le thread d'écriture
+OutputWriter::OutputWriter(const string& filename, Format fileFormat, int interval, size_t maxPending)
+    : file(nullptr), format(fileFormat), keyframeInterval(max(1, interval)), capacity(max<size_t>(1, maxPending)),
+      closing(false), failed(false), sinceKeyframe(0) {
+    // Le journal delta est écrit en binaire pour que ses lignes ne dépendent pas de la plateforme
+    file = fopen(filename.c_str(), format == DELTA ? "wb" : "w");
+    if (!file) {
+        throw runtime_error("Impossible d'ouvrir le fichier de sortie.");
+    }
+    setvbuf(file, nullptr, _IONBF, 0); // Les blocs sont déjà regroupés par le thread d'écriture
+    worker = thread(&OutputWriter::run, this);
+}
+
+OutputWriter::~OutputWriter() {
+    close();
+}
+
+// Ajoute une génération à écrire (bloque si la file est pleine)
+void OutputWriter::write(const GridSnapshot& snapshot, long long generation) {
+    unique_lock<mutex> lock(queueMutex);
+    notFull.wait(lock, [this] { return queue.size() < capacity || closing; });
+    if (closing) {
+        return;
+    }
+    Pending pending = { snapshot, generation };
+    queue.push_back(pending);
+    notEmpty.notify_one();
+}
+
+// Attend l'écriture de toutes les générations et ferme le fichier
+bool OutputWriter::close() {
+    {
+        lock_guard<mutex> lock(queueMutex);
+        if (!file) {
+            return !failed; // Déjà fermé
+        }
+        closing = true;
+    }
+    notEmpty.notify_all();
+    notFull.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+    if (file) {
+        failed = fclose(file) != 0 || failed;
+        file = nullptr;
+    }
+    return !failed;
+}
+
+// Thread d'écriture : met en forme les générations et les écrit par blocs
+void OutputWriter::run() {
+    Trace::setThreadName("OutputWriter");
+    string buffer;
+    buffer.reserve(FLUSH_SIZE + (1 << 16));
+    for (;;) {
+        Pending pending;
+        {
+            unique_lock<mutex> lock(queueMutex);
+            notEmpty.wait(lock, [this] { return !queue.empty() || closing; });
+            if (queue.empty()) {
+                break; // Fermeture demandée et file vide
+            }
+            pending = queue.front();
+            queue.pop_front();
+        }
+        notFull.notify_one();
+
+        TRACE_SPAN("OutputWriter::write"); // Mise en forme et, par blocs, écriture sur le disque
+        if (format == DELTA) {
+            formatDelta(pending.snapshot, pending.generation, buffer);
+        }
+        else {
+            formatText(pending.snapshot, buffer);
+        }
+        if (buffer.size() >= FLUSH_SIZE) {
+            failed = fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size() || failed;
+            buffer.clear();
+        }
+    }
+    if (!buffer.empty()) {
+        failed = fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size() || failed;
+    }
+}
+
+// Met en forme une génération complète suivie d'un séparateur
+void OutputWriter::formatText(const GridSnapshot& snapshot, string& buffer) {
+    appendRows(snapshot, buffer);
+    buffer.append(SEPARATOR, sizeof(SEPARATOR) - 1);
+}
+
+// Met en forme une génération du journal delta :
+//   « K <génération> » suivi de la grille complète (image clé), ou
+//   « D <génération> <n> » suivi de n lignes « <ligne> <colonne> <état> »
+void OutputWriter::formatDelta(const GridSnapshot& snapshot, long long generation, string& buffer) {
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    int rows = snapshot.getRows();
+    int cols = snapshot.getCols();
+    size_t keyframeSize = static_cast<size_t>(rows) * (2 * cols + 1);
+
+    if (previous.getRows() == 0) {
+        // En-tête du journal : dimensions de la grille
+        buffer += "DELTA ";
+        appendNumber(buffer, rows);
+        buffer += ' ';
+        appendNumber(buffer, cols);
+        buffer += '\n';
+    }
+
+    bool keyframe = sinceKeyframe == 0 || rows != previous.getRows() || cols != previous.getCols();
+    if (!keyframe) {
+        string changes;
+        long long count = 0;
+        // Seules les tuiles qui ne sont plus partagées avec la génération précédente sont comparées
+        snapshot.changedTiles(previous, changedTiles);
+        for (size_t k = 0; k < changedTiles.size() && changes.size() < keyframeSize; ++k) {
+            int tr = changedTiles[k] / snapshot.getTileCols();
+            int tc = changedTiles[k] % snapshot.getTileCols();
+            const GridSnapshot::TilePtr& tile = snapshot.getTile(tr, tc);
+            const GridSnapshot::TilePtr& before = previous.getTile(tr, tc);
+            int height = min(tileSize, rows - tr * tileSize);
+            int width = min(tileSize, cols - tc * tileSize);
+            for (int i = 0; i < height; ++i) {
+                const unsigned char* now = tile->cells + i * tileSize;
+                const unsigned char* old = before->cells + i * tileSize;
+                for (int j = 0; j < width; ++j) {
+                    char token = TOKENS[now[j] & 3];
+                    if (token != TOKENS[old[j] & 3]) {
+                        appendNumber(changes, tr * tileSize + i);
+                        changes += ' ';
+                        appendNumber(changes, tc * tileSize + j);
+                        changes += ' ';
+                        changes += token;
+                        changes += '\n';
+                        ++count;
+                    }
+                }
+            }
+        }
+        // Une image clé est écrite à la place d'un delta plus volumineux qu'elle
+        keyframe = changes.size() >= keyframeSize;
+        if (!keyframe) {
+            buffer += "D ";
+            appendNumber(buffer, generation);
+            buffer += ' ';
+            appendNumber(buffer, count);
+            buffer += '\n';
+            buffer += changes;
+        }
+    }
+
+    if (keyframe) {
+        buffer += "K ";
+        appendNumber(buffer, generation);
+        buffer += '\n';
+        appendRows(snapshot, buffer);
+        sinceKeyframe = 0;
+    }
+    sinceKeyframe = (sinceKeyframe + 1) % keyframeInterval;
+    previous = snapshot;
+}
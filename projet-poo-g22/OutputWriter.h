@@ -0,0 +1,105 @@
+// components/OutputWriter.h
+#ifndef OUTPUTWRITER_H
+#define OUTPUTWRITER_H
+
+#include "Snapshot.h"
+#include <string>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdio>
+
+/**
+ * @brief Écriture asynchrone des générations dans un fichier texte.
+ *
+ * La simulation dépose des instantanés (tuiles partagées, donc peu coûteux)
+ * dans une file bornée ; un thread dédié les met en forme et les écrit par
+ * gros blocs. Les générations sont écrites dans l'ordre et aucune n'est
+ * perdue : quand la file est pleine, write() attend que le thread d'écriture
+ * la vide.
+ *
+ * Deux formats sont disponibles :
+ * - TEXTE : la grille complète à chaque génération (« 1 », « X », « 0 »,
+ *   un séparateur entre deux états) ;
+ * - DELTA : un journal (relu par DeltaLogReader) contenant une image clé
+ *   toutes les keyframeInterval générations et, entre deux, seulement les
+ *   cellules modifiées. Seules les tuiles qui ne sont plus partagées avec
+ *   l'instantané précédent sont comparées.
+ */
+class OutputWriter {
+public:
+    /**
+     * @brief Format du fichier de sortie.
+     */
+    enum Format {
+        TEXTE, // Grille complète à chaque génération
+        DELTA  // Images clés et cellules modifiées
+    };
+
+    /**
+     * @brief Ouvre le fichier (tronqué) et démarre le thread d'écriture.
+     *
+     * @param filename Nom du fichier de sortie.
+     * @param format Format du fichier.
+     * @param keyframeInterval Générations entre deux images clés (format DELTA).
+     * @param capacity Nombre maximal de générations en attente.
+     * @throws std::runtime_error Si le fichier ne peut pas être ouvert.
+     */
+    explicit OutputWriter(const std::string& filename, Format format = TEXTE, int keyframeInterval = 64, std::size_t capacity = 16);
+
+    /**
+     * @brief Termine l'écriture des générations en attente et ferme le fichier.
+     */
+    ~OutputWriter();
+
+    OutputWriter(const OutputWriter&) = delete;
+    OutputWriter& operator=(const OutputWriter&) = delete;
+
+    /**
+     * @brief Ajoute une génération à écrire (bloque si la file est pleine).
+     *
+     * @param snapshot Instantané de la grille.
+     * @param generation Numéro de la génération (format DELTA).
+     */
+    void write(const GridSnapshot& snapshot, long long generation = 0);
+
+    /**
+     * @brief Attend l'écriture de toutes les générations et ferme le fichier.
+     *
+     * @return true Si toutes les écritures ont réussi.
+     * @return false Sinon.
+     */
+    bool close();
+
+private:
+    /**
+     * @brief Génération en attente d'écriture.
+     */
+    struct Pending {
+        GridSnapshot snapshot;
+        long long generation;
+    };
+
+    std::FILE* file;
+    Format format;
+    int keyframeInterval;
+    std::size_t capacity;
+    std::deque<Pending> queue;
+    std::mutex queueMutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    bool closing;
+    bool failed;
+    std::thread worker;
+    GridSnapshot previous; // Dernière génération écrite (format DELTA)
+    std::vector<int> changedTiles; // Tuiles modifiées depuis previous
+    int sinceKeyframe; // Générations écrites depuis la dernière image clé
+
+    void run();
+    void formatText(const GridSnapshot& snapshot, std::string& buffer);
+    void formatDelta(const GridSnapshot& snapshot, long long generation, std::string& buffer);
+};
+
+#endif // OUTPUTWRITER_H
@@ -0,0 +1,94 @@
+// components/Palette.cpp
+#include "Palette.h"
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+/**
+ * @brief Point de contrôle d'un dégradé.
+ */
+struct Stop {
+    unsigned value;
+    unsigned char rgb[3];
+};
+
+/**
+ * @brief Dégradé de 256 couleurs interpolé entre des points de contrôle.
+ */
+struct Gradient {
+    unsigned char rgb[256][3];
+
+    template <size_t N>
+    explicit Gradient(const Stop (&stops)[N]) {
+        for (unsigned v = 0; v < 256; ++v) {
+            size_t k = 1;
+            while (k + 1 < N && stops[k].value < v) {
+                ++k;
+            }
+            const Stop& low = stops[k - 1];
+            const Stop& high = stops[k];
+            unsigned span = high.value - low.value;
+            unsigned t = min(span, v > low.value ? v - low.value : 0u);
+            for (int c = 0; c < 3; ++c) {
+                rgb[v][c] = static_cast<unsigned char>((low.rgb[c] * (span - t) + high.rgb[c] * t + span / 2) / span);
+            }
+        }
+    }
+};
+
+const Stop AGE_STOPS[] = {
+    { 0, { 255, 255, 255 } },  // Naissance : blanc
+    { 8, { 255, 220, 0 } },    // Jeune : jaune
+    { 32, { 0, 200, 80 } },    // Vert
+    { 96, { 0, 160, 255 } },   // Cyan
+    { 255, { 40, 40, 255 } }   // Ancienne : bleu
+};
+
+const Stop HEAT_STOPS[] = {
+    { 0, { 0, 0, 0 } },        // Calme : noir
+    { 64, { 160, 0, 0 } },     // Rouge sombre
+    { 128, { 255, 120, 0 } },  // Orange
+    { 192, { 255, 230, 40 } }, // Jaune
+    { 255, { 255, 255, 255 } } // Très active : blanc
+};
+
+const Gradient& ageGradient() {
+    static const Gradient gradient(AGE_STOPS);
+    return gradient;
+}
+
+const Gradient& heatGradient() {
+    static const Gradient gradient(HEAT_STOPS);
+    return gradient;
+}
+
+} // namespace
+
+const unsigned char* Palette::ageColor(unsigned age) {
+    return ageGradient().rgb[min(age, 255u)];
+}
+
+const unsigned char* Palette::heatColor(unsigned heat) {
+    return heatGradient().rgb[min(heat, 255u)];
+}
+
+// Couleur moyenne d'un bloc : part des obstacles en rouge, reste selon l'état ou les compteurs
+void Palette::blockColor(GridSnapshot::Counters counters, unsigned count, unsigned alive, unsigned obstacles,
+                         unsigned long long counterSum, unsigned char rgb[3]) {
+    static const unsigned char WHITE[3] = { 255, 255, 255 };
+    const unsigned char* color = WHITE; // Couleur des cellules colorées (vivantes ou actives)
+    unsigned colored = alive;
+    if (counters == GridSnapshot::AGE && alive > 0) {
+        color = ageColor(static_cast<unsigned>(counterSum / alive)); // Âge moyen des cellules vivantes
+    }
+    else if (counters == GridSnapshot::ACTIVITE) {
+        colored = count - obstacles;
+        color = heatColor(colored > 0 ? static_cast<unsigned>(counterSum / colored) : 0); // Activité moyenne
+    }
+    static const unsigned char RED[3] = { 255, 0, 0 };
+    for (int c = 0; c < 3; ++c) {
+        rgb[c] = static_cast<unsigned char>((color[c] * colored + RED[c] * obstacles + count / 2) / count);
+    }
+}
@@ -0,0 +1,43 @@
+// components/Palette.h
+#ifndef PALETTE_H
+#define PALETTE_H
+
+#include "Snapshot.h"
+
+/**
+ * @brief Couleurs des cellules pour l'affichage, selon leur état et leurs compteurs.
+ *
+ * Sans compteurs, ce sont les couleurs d'origine : vivante en blanc,
+ * obstacle en rouge, vide en noir. Avec les compteurs d'âge, les cellules
+ * vivantes passent du blanc (naissance) au jaune, au vert puis au bleu
+ * (cellules anciennes). Avec les compteurs d'activité, chaque cellule non
+ * obstacle va du noir (calme) au rouge, à l'orange puis au blanc (zones qui
+ * changent sans cesse). Les obstacles restent rouges.
+ */
+class Palette {
+public:
+    /**
+     * @brief Couleur moyenne d'un bloc de cellules.
+     *
+     * @param counters Signification des compteurs de l'instantané.
+     * @param count Nombre de cellules du bloc (1 pour une seule cellule).
+     * @param alive Nombre de cellules vivantes.
+     * @param obstacles Nombre d'obstacles.
+     * @param counterSum Somme des compteurs du bloc.
+     * @param rgb Couleur (rouge, vert, bleu).
+     */
+    static void blockColor(GridSnapshot::Counters counters, unsigned count, unsigned alive, unsigned obstacles,
+                           unsigned long long counterSum, unsigned char rgb[3]);
+
+    /**
+     * @brief Couleur d'une cellule vivante selon son âge (0 à 255).
+     */
+    static const unsigned char* ageColor(unsigned age);
+
+    /**
+     * @brief Couleur d'une cellule selon son activité (0 à 255).
+     */
+    static const unsigned char* heatColor(unsigned heat);
+};
+
+#endif // PALETTE_H
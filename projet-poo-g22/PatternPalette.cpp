@@ -0,0 +1,58 @@
+// components/PatternPalette.cpp
+#include "PatternPalette.h"
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+/**
+ * @brief Construction compactée : une ligne par mot, le bit j pour la colonne j.
+ */
+struct PackedPattern {
+    const char* name;
+    int rows;
+    int cols;
+    uint64_t words[16];
+};
+
+const PackedPattern PATTERNS[PatternPalette::MOTIFS] = {
+    { "Planeur", 3, 3, { 0x2, 0x4, 0x7 } },
+    { "Clignotant", 1, 3, { 0x7 } },
+    { "Vaisseau léger", 4, 5, { 0x12, 0x1, 0x11, 0xF } },
+    { "Pulsar", 13, 13, { 0x71C, 0x0, 0x10A1, 0x10A1, 0x10A1, 0x71C, 0x0, 0x71C, 0x10A1, 0x10A1, 0x10A1, 0x0, 0x71C } },
+    { "Canon de Gosper", 9, 36, { 0x1000000, 0x1400000, 0xC00303000, 0xC00308800, 0x310403, 0x1434403, 0x1010400, 0x8800, 0x3000 } },
+    { "R-pentomino", 3, 3, { 0x6, 0x3, 0x2 } }
+};
+
+} // namespace
+
+// Plan de bits d'une construction (copie directe des mots)
+BitPlane PatternPalette::pattern(Motif motif) {
+    const PackedPattern& packed = PATTERNS[motif];
+    BitPlane plane(packed.rows, packed.cols);
+    for (int i = 0; i < packed.rows; ++i) {
+        plane.rowData(i)[0] = packed.words[i];
+    }
+    return plane;
+}
+
+const char* PatternPalette::name(Motif motif) {
+    return PATTERNS[motif].name;
+}
+
+// Disque de rayon radius, rempli ligne par ligne
+BitPlane PatternPalette::brush(int radius) {
+    radius = min(max(radius, 0), MAX_BRUSH_RADIUS);
+    int size = 2 * radius + 1;
+    BitPlane plane(size, size);
+    for (int i = 0; i < size; ++i) {
+        int dy = i - radius;
+        int halfWidth = 0;
+        while (halfWidth < radius && (halfWidth + 1) * (halfWidth + 1) + dy * dy <= radius * radius + radius) {
+            ++halfWidth;
+        }
+        plane.setRun(i, radius - halfWidth, 2 * halfWidth + 1);
+    }
+    return plane;
+}
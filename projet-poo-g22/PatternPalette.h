@@ -0,0 +1,52 @@
+// components/PatternPalette.h
+#ifndef PATTERNPALETTE_H
+#define PATTERNPALETTE_H
+
+#include "BitPlane.h"
+
+/**
+ * @brief Constructions préprogrammées et pinceaux pour éditer la grille.
+ *
+ * Les motifs sont stockés déjà compactés (un mot de 64 bits par ligne, le
+ * bit j pour la colonne j) : les obtenir revient à recopier quelques mots,
+ * sans lecture de fichier ni analyse de texte. Ils sont ensuite appliqués à
+ * la grille par Grid::stamp(), après rotation ou miroir éventuels
+ * (BitPlane::transformed()).
+ */
+class PatternPalette {
+public:
+    /**
+     * @brief Constructions disponibles.
+     */
+    enum Motif {
+        PLANEUR,        // Vaisseau diagonal de période 4
+        CLIGNOTANT,     // Oscillateur de période 2
+        VAISSEAU_LEGER, // Vaisseau orthogonal de période 4
+        PULSAR,         // Oscillateur de période 3
+        CANON_GOSPER,   // Émet un planeur toutes les 30 générations
+        R_PENTOMINO     // Mathusalem (stabilisé après 1103 générations)
+    };
+
+    static const int MOTIFS = 6; // Nombre de constructions
+    static const int MAX_BRUSH_RADIUS = 31; // Rayon maximal d'un pinceau
+
+    /**
+     * @brief Plan de bits d'une construction (orientation d'origine).
+     */
+    static BitPlane pattern(Motif motif);
+
+    /**
+     * @brief Nom affiché d'une construction.
+     */
+    static const char* name(Motif motif);
+
+    /**
+     * @brief Pinceau en forme de disque.
+     *
+     * @param radius Rayon en cellules (0 : une seule cellule), borné à MAX_BRUSH_RADIUS.
+     * @return BitPlane Disque de 2 * radius + 1 cellules de côté.
+     */
+    static BitPlane brush(int radius);
+};
+
+#endif // PATTERNPALETTE_H
@@ -0,0 +1,255 @@
+// components/Quadtree.cpp
+#include "Quadtree.h"
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+// Rectangle englobant relatif à l'origine d'un nœud
+struct Box {
+    bool empty;
+    long long top;
+    long long left;
+    long long bottom;
+    long long right;
+};
+
+// Extrait l'octet d'une ligne de 8 cellules alignée sur 8 colonnes
+uint64_t rowByte(const BitPlane& plane, int row, int col) {
+    return (plane.rowData(row)[col >> 6] >> (col & 63)) & 0xFF;
+}
+
+} // namespace
+
+Quadtree::Quadtree() : root(EMPTY), level(LEAF_LEVEL) {
+    Node empty = {};
+    empty.level = -1;
+    nodes.push_back(empty); // Nœud EMPTY, jamais inséré dans la table
+}
+
+size_t Quadtree::NodeHash::operator()(const Node& node) const {
+    uint64_t h = static_cast<uint64_t>(node.level) * 0x9E3779B97F4A7C15ull;
+    h ^= node.alive + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2);
+    h ^= node.obstacles + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2);
+    for (int i = 0; i < 4; ++i) {
+        h ^= node.child[i] + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2);
+    }
+    return static_cast<size_t>(h);
+}
+
+bool Quadtree::NodeEqual::operator()(const Node& a, const Node& b) const {
+    return a.level == b.level && a.alive == b.alive && a.obstacles == b.obstacles &&
+           a.child[0] == b.child[0] && a.child[1] == b.child[1] &&
+           a.child[2] == b.child[2] && a.child[3] == b.child[3];
+}
+
+// Retourne l'identifiant d'un nœud, en le créant s'il n'existe pas encore
+Quadtree::NodeId Quadtree::intern(const Node& node) {
+    unordered_map<Node, NodeId, NodeHash, NodeEqual>::const_iterator it = unique.find(node);
+    if (it != unique.end()) {
+        return it->second;
+    }
+    NodeId id = static_cast<NodeId>(nodes.size());
+    nodes.push_back(node);
+    unique.emplace(node, id);
+    return id;
+}
+
+Quadtree::NodeId Quadtree::leaf(uint64_t alive, uint64_t obstacles) {
+    if (!(alive | obstacles)) {
+        return EMPTY;
+    }
+    Node node = {};
+    node.level = LEAF_LEVEL;
+    node.alive = alive & ~obstacles; // Un obstacle l'emporte sur une cellule vivante
+    node.obstacles = obstacles;
+    return intern(node);
+}
+
+Quadtree::NodeId Quadtree::node(int nodeLevel, NodeId nw, NodeId ne, NodeId sw, NodeId se) {
+    if (nw == EMPTY && ne == EMPTY && sw == EMPTY && se == EMPTY) {
+        return EMPTY;
+    }
+    Node node = {};
+    node.level = nodeLevel;
+    node.child[0] = nw;
+    node.child[1] = ne;
+    node.child[2] = sw;
+    node.child[3] = se;
+    return intern(node);
+}
+
+void Quadtree::setRoot(NodeId id, int rootLevel) {
+    root = id;
+    level = id == EMPTY ? rootLevel : nodes[id].level;
+}
+
+// Construit un arbre à partir de plans de bits : feuilles de 8 x 8, puis regroupement par 2 x 2
+Quadtree Quadtree::fromPattern(const BitPlane& alive, const BitPlane& obstacles) {
+    Quadtree tree;
+    int rows = alive.getRows();
+    int cols = alive.getCols();
+    bool hasObstacles = obstacles.getRows() == rows && obstacles.getCols() == cols;
+
+    int blockRows = (rows + 7) / 8;
+    int blockCols = (cols + 7) / 8;
+    vector<NodeId> blocks(static_cast<size_t>(blockRows) * blockCols, EMPTY);
+    for (int br = 0; br < blockRows; ++br) {
+        int height = min(8, rows - br * 8);
+        for (int bc = 0; bc < blockCols; ++bc) {
+            uint64_t a = 0;
+            uint64_t o = 0;
+            for (int r = 0; r < height; ++r) {
+                a |= rowByte(alive, br * 8 + r, bc * 8) << (r * 8);
+                if (hasObstacles) o |= rowByte(obstacles, br * 8 + r, bc * 8) << (r * 8);
+            }
+            blocks[static_cast<size_t>(br) * blockCols + bc] = tree.leaf(a, o);
+        }
+    }
+
+    int nodeLevel = LEAF_LEVEL;
+    while (blockRows > 1 || blockCols > 1) {
+        int parentRows = (blockRows + 1) / 2;
+        int parentCols = (blockCols + 1) / 2;
+        vector<NodeId> parents(static_cast<size_t>(parentRows) * parentCols);
+        for (int pr = 0; pr < parentRows; ++pr) {
+            for (int pc = 0; pc < parentCols; ++pc) {
+                NodeId children[4];
+                for (int k = 0; k < 4; ++k) {
+                    int r = 2 * pr + (k >> 1);
+                    int c = 2 * pc + (k & 1);
+                    children[k] = r < blockRows && c < blockCols ? blocks[static_cast<size_t>(r) * blockCols + c] : EMPTY;
+                }
+                parents[static_cast<size_t>(pr) * parentCols + pc] =
+                    tree.node(nodeLevel + 1, children[0], children[1], children[2], children[3]);
+            }
+        }
+        blocks.swap(parents);
+        blockRows = parentRows;
+        blockCols = parentCols;
+        ++nodeLevel;
+    }
+    tree.setRoot(blocks.empty() ? EMPTY : blocks[0], nodeLevel);
+    return tree;
+}
+
+// Rectangle englobant : un passage sur les nœuds dans l'ordre de création
+bool Quadtree::bounds(long long& top, long long& left, long long& bottom, long long& right) const {
+    if (root == EMPTY) {
+        return false;
+    }
+    vector<Box> boxes(root + 1);
+    boxes[EMPTY].empty = true;
+    for (NodeId id = 1; id <= root; ++id) {
+        const Node& node = nodes[id];
+        Box& box = boxes[id];
+        box.empty = true;
+        if (node.level == LEAF_LEVEL) {
+            uint64_t cells = node.alive | node.obstacles;
+            uint64_t columns = 0;
+            for (int r = 0; r < 8; ++r) {
+                uint64_t line = (cells >> (r * 8)) & 0xFF;
+                if (!line) continue;
+                if (box.empty) box.top = r;
+                box.bottom = r;
+                box.empty = false;
+                columns |= line;
+            }
+            box.left = 8;
+            box.right = -1;
+            for (int c = 0; c < 8; ++c) {
+                if ((columns >> c) & 1) {
+                    box.left = min(box.left, static_cast<long long>(c));
+                    box.right = c;
+                }
+            }
+            continue;
+        }
+        long long half = 1LL << (node.level - 1);
+        for (int k = 0; k < 4; ++k) {
+            const Box& child = boxes[node.child[k]];
+            if (child.empty) continue;
+            long long rowOffset = (k >> 1) * half;
+            long long colOffset = (k & 1) * half;
+            if (box.empty) {
+                box.top = child.top + rowOffset;
+                box.left = child.left + colOffset;
+                box.bottom = child.bottom + rowOffset;
+                box.right = child.right + colOffset;
+                box.empty = false;
+            }
+            else {
+                box.top = min(box.top, child.top + rowOffset);
+                box.left = min(box.left, child.left + colOffset);
+                box.bottom = max(box.bottom, child.bottom + rowOffset);
+                box.right = max(box.right, child.right + colOffset);
+            }
+        }
+    }
+    const Box& box = boxes[root];
+    top = box.top;
+    left = box.left;
+    bottom = box.bottom;
+    right = box.right;
+    return !box.empty;
+}
+
+// Copie une région de l'arbre dans des plans de bits
+void Quadtree::extract(long long top, long long left, BitPlane& alive, BitPlane& obstacles) const {
+    extractNode(root, level, 0, 0, top, left, alive, obstacles);
+}
+
+void Quadtree::extractNode(NodeId id, int nodeLevel, long long row, long long col,
+                           long long top, long long left, BitPlane& alive, BitPlane& obstacles) const {
+    long long size = 1LL << nodeLevel;
+    if (id == EMPTY || row >= top + alive.getRows() || row + size <= top ||
+        col >= left + alive.getCols() || col + size <= left) {
+        return; // Sous-arbre vide ou hors de la région
+    }
+    const Node& node = nodes[id];
+    if (nodeLevel == LEAF_LEVEL) {
+        for (int r = 0; r < 8; ++r) {
+            long long y = row + r - top;
+            uint64_t a = (node.alive >> (r * 8)) & 0xFF;
+            uint64_t o = (node.obstacles >> (r * 8)) & 0xFF;
+            if (y < 0 || y >= alive.getRows() || !(a | o)) continue;
+            for (int c = 0; c < 8; ++c) {
+                long long x = col + c - left;
+                if (x < 0 || x >= alive.getCols()) continue;
+                if ((o >> c) & 1) obstacles.set(static_cast<int>(y), static_cast<int>(x));
+                else if ((a >> c) & 1) alive.set(static_cast<int>(y), static_cast<int>(x));
+            }
+        }
+        return;
+    }
+    long long half = size / 2;
+    for (int k = 0; k < 4; ++k) {
+        extractNode(node.child[k], nodeLevel - 1, row + (k >> 1) * half, col + (k & 1) * half,
+                    top, left, alive, obstacles);
+    }
+}
+
+// État d'une cellule, en descendant depuis la racine
+CellState Quadtree::get(long long row, long long col) const {
+    if (row < 0 || col < 0 || row >= (1LL << level) || col >= (1LL << level)) {
+        return VIDE;
+    }
+    NodeId id = root;
+    int nodeLevel = level;
+    while (id != EMPTY && nodeLevel > LEAF_LEVEL) {
+        long long half = 1LL << (nodeLevel - 1);
+        int k = (row >= half ? 2 : 0) + (col >= half ? 1 : 0);
+        row &= half - 1;
+        col &= half - 1;
+        id = nodes[id].child[k];
+        --nodeLevel;
+    }
+    if (id == EMPTY) {
+        return VIDE;
+    }
+    int bit = static_cast<int>(row * 8 + col);
+    if ((nodes[id].obstacles >> bit) & 1) return OBSTACLE;
+    if ((nodes[id].alive >> bit) & 1) return VIVANT;
+    return VIDE;
+}
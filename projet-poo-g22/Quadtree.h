@@ -0,0 +1,124 @@
+// components/Quadtree.h
+#ifndef QUADTREE_H
+#define QUADTREE_H
+
+#include "BitPlane.h"
+#include "Cellule.h"
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Arbre quaternaire à nœuds partagés (hash-consing).
+ *
+ * Un nœud de niveau k couvre un carré de 2^k x 2^k cellules. Les feuilles
+ * (niveau 3) contiennent 8 x 8 cellules sous forme de deux masques de
+ * 64 bits (vivantes, obstacles), la cellule (r, c) étant le bit r * 8 + c.
+ * Deux nœuds identiques ne sont stockés qu'une fois : un motif très
+ * répétitif (reproducteur, métapixels) occupe peu de mémoire quelle que
+ * soit sa taille. Le nœud EMPTY représente un carré vide de n'importe quel
+ * niveau.
+ */
+class Quadtree {
+public:
+    typedef std::uint32_t NodeId;
+
+    static const NodeId EMPTY = 0;
+    static const int LEAF_LEVEL = 3; // Feuilles de 8 x 8 cellules
+    static const int MAX_LEVEL = 62; // Coordonnées sur 64 bits signés
+
+    /**
+     * @brief Nœud de l'arbre : feuille (masques) ou nœud interne (quatre enfants).
+     */
+    struct Node {
+        int level;
+        std::uint64_t alive; // Feuilles uniquement
+        std::uint64_t obstacles; // Feuilles uniquement
+        NodeId child[4]; // Nœuds internes : nord-ouest, nord-est, sud-ouest, sud-est
+    };
+
+    Quadtree();
+
+    /**
+     * @brief Construit un arbre à partir de plans de bits de mêmes dimensions.
+     *
+     * @param alive Cellules vivantes.
+     * @param obstacles Obstacles (plan vide ou de mêmes dimensions).
+     */
+    static Quadtree fromPattern(const BitPlane& alive, const BitPlane& obstacles);
+
+    /**
+     * @brief Retourne la feuille correspondant aux masques (EMPTY si vide).
+     */
+    NodeId leaf(std::uint64_t alive, std::uint64_t obstacles);
+
+    /**
+     * @brief Retourne le nœud de niveau level ayant ces enfants (EMPTY si tous sont vides).
+     */
+    NodeId node(int level, NodeId nw, NodeId ne, NodeId sw, NodeId se);
+
+    /**
+     * @brief Calcule le rectangle englobant des cellules non vides.
+     *
+     * Chaque nœud n'est examiné qu'une fois, même s'il apparaît à de
+     * nombreuses positions.
+     *
+     * @return true Si l'arbre contient au moins une cellule non vide.
+     * @return false Sinon.
+     */
+    bool bounds(long long& top, long long& left, long long& bottom, long long& right) const;
+
+    /**
+     * @brief Copie une région de l'arbre dans des plans de bits (conversion sans perte).
+     *
+     * La région commence en (top, left) et a les dimensions des plans ; les
+     * sous-arbres vides ou hors de la région ne sont pas parcourus.
+     */
+    void extract(long long top, long long left, BitPlane& alive, BitPlane& obstacles) const;
+
+    /**
+     * @brief État d'une cellule (VIDE hors de l'arbre).
+     */
+    CellState get(long long row, long long col) const;
+
+    /**
+     * @brief Définit la racine de l'arbre.
+     *
+     * @param id Racine.
+     * @param level Niveau de la racine (utile si elle est EMPTY).
+     */
+    void setRoot(NodeId id, int level);
+
+    // Getters
+    NodeId getRoot() const { return root; }
+    int getLevel() const { return level; }
+    const Node& getNode(NodeId id) const { return nodes[id]; }
+    std::size_t getNodeCount() const { return nodes.size(); }
+
+private:
+    /**
+     * @brief Hachage d'un nœud pour la table de partage.
+     */
+    struct NodeHash {
+        std::size_t operator()(const Node& node) const;
+    };
+
+    /**
+     * @brief Égalité de deux nœuds pour la table de partage.
+     */
+    struct NodeEqual {
+        bool operator()(const Node& a, const Node& b) const;
+    };
+
+    std::vector<Node> nodes; // Les enfants sont toujours créés avant leurs parents
+    std::unordered_map<Node, NodeId, NodeHash, NodeEqual> unique;
+    NodeId root;
+    int level;
+
+    NodeId intern(const Node& node);
+    void extractNode(NodeId id, int nodeLevel, long long row, long long col,
+                     long long top, long long left, BitPlane& alive, BitPlane& obstacles) const;
+};
+
+#endif // QUADTREE_H
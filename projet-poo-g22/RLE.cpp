@@ -0,0 +1,228 @@
+// components/RLE.cpp
+#include "RLE.h"
+#include "MappedFile.h"
+#include <fstream>
+#include <stdexcept>
+#include <cstring>
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+const size_t MAX_LINE = 70; // Longueur maximale d'une ligne RLE
+const size_t FLUSH_SIZE = 1 << 16;
+const long long MAX_CELLS = 1LL << 28; // Taille maximale d'un motif, comme pour la conversion Macrocell
+const long long MAX_RUN = 1LL << 40; // Au-delà, une longueur de suite dépasse de toute façon le motif
+
+bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Première colonne à partir de col dont l'état diffère de (alive, obstacle)
+int nextChange(const uint64_t* alive, const uint64_t* obstacles, int col, int cols, bool isAlive, bool isObstacle) {
+    uint64_t aliveRef = isAlive ? ~uint64_t(0) : 0;
+    uint64_t obstacleRef = isObstacle ? ~uint64_t(0) : 0;
+    int word = col >> 6;
+    uint64_t diff = ((alive[word] ^ aliveRef) | (obstacles ? obstacles[word] ^ obstacleRef : 0)) & (~uint64_t(0) << (col & 63));
+    int words = (cols + 63) / 64;
+    while (!diff) {
+        if (++word >= words) return cols;
+        diff = (alive[word] ^ aliveRef) | (obstacles ? obstacles[word] ^ obstacleRef : 0);
+    }
+    int change = (word << 6) + BitPlane::lowestBit(diff);
+    return change < cols ? change : cols;
+}
+
+// Tampon d'écriture RLE respectant la longueur de ligne maximale
+class RLEOutput {
+public:
+    explicit RLEOutput(ostream& stream) : out(stream), lineLength(0) { buffer.reserve(FLUSH_SIZE + MAX_LINE); }
+
+    void item(long long count, char tag) {
+        char text[24];
+        int length = 0;
+        if (count > 1) {
+            char digits[20];
+            int n = 0;
+            while (count > 0) {
+                digits[n++] = static_cast<char>('0' + count % 10);
+                count /= 10;
+            }
+            while (n > 0) text[length++] = digits[--n];
+        }
+        text[length++] = tag;
+        if (lineLength + length > MAX_LINE) {
+            buffer += '\n';
+            lineLength = 0;
+        }
+        buffer.append(text, length);
+        lineLength += length;
+        if (buffer.size() >= FLUSH_SIZE) flush();
+    }
+
+    void flush() {
+        out.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+        buffer.clear();
+    }
+
+private:
+    ostream& out;
+    string buffer;
+    size_t lineLength;
+};
+
+} // namespace
+
+// Lit un fichier RLE
+Pattern RLE::read(const string& filename) {
+    MappedFile file;
+    file.open(filename);
+    return parse(file.data(), file.size());
+}
+
+// Analyse un contenu RLE en mémoire
+Pattern RLE::parse(const char* data, size_t size) {
+    const char* p = data;
+    const char* end = data + size;
+
+    // Commentaires « # » puis en-tête « x = m, y = n, rule = ... »
+    while (p < end) {
+        while (p < end && isSpace(*p)) ++p;
+        if (p < end && *p == '#') {
+            while (p < end && *p != '\n') ++p;
+            continue;
+        }
+        break;
+    }
+    if (p == end || *p != 'x') {
+        throw runtime_error("En-tête RLE manquant.");
+    }
+
+    long long width = -1;
+    long long height = -1;
+    Pattern pattern;
+    while (p < end && *p != '\n') {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == ',')) ++p;
+        const char* key = p;
+        while (p < end && *p != '=' && *p != '\n') ++p;
+        if (p == end || *p != '=') break;
+        const char* keyEnd = p++;
+        while (keyEnd > key && isSpace(keyEnd[-1])) --keyEnd;
+        while (p < end && (*p == ' ' || *p == '\t')) ++p;
+        const char* value = p;
+        while (p < end && *p != ',' && *p != '\n') ++p;
+        const char* valueEnd = p;
+        while (valueEnd > value && isSpace(valueEnd[-1])) --valueEnd;
+
+        size_t keyLength = static_cast<size_t>(keyEnd - key);
+        if (keyLength == 1 && (*key == 'x' || *key == 'y')) {
+            long long number = 0;
+            for (const char* c = value; c < valueEnd; ++c) {
+                if (*c < '0' || *c > '9') throw runtime_error("En-tête RLE invalide.");
+                number = number * 10 + (*c - '0');
+                if (number > MAX_CELLS) throw runtime_error("Motif RLE trop grand.");
+            }
+            (*key == 'x' ? width : height) = number;
+        }
+        else if (keyLength == 4 && memcmp(key, "rule", 4) == 0) {
+            pattern.rule = Rule::parse(string(value, valueEnd));
+        }
+    }
+    if (width < 0 || height < 0) {
+        throw runtime_error("En-tête RLE invalide.");
+    }
+    if (max(width, 1LL) * max(height, 1LL) > MAX_CELLS) {
+        throw runtime_error("Motif RLE trop grand.");
+    }
+
+    int cols = static_cast<int>(width);
+    int rows = static_cast<int>(height);
+    pattern.alive = BitPlane(rows, cols);
+    pattern.obstacles = BitPlane(rows, cols);
+
+    // Corps : suites « <nombre><état> », « $ » fin de ligne, « ! » fin du motif
+    long long row = 0;
+    long long col = 0;
+    long long count = 0;
+    int prefix = 0; // Préfixe « p » à « y » des états multi-états supérieurs à 24
+    for (; p < end; ++p) {
+        char c = *p;
+        if (c >= '0' && c <= '9') {
+            count = count < MAX_RUN ? count * 10 + (c - '0') : MAX_RUN;
+            continue;
+        }
+        if (isSpace(c)) continue;
+        if (c == '!') break;
+        if (c >= 'p' && c <= 'y') {
+            prefix = c - 'p' + 1;
+            continue;
+        }
+
+        long long run = count > 0 ? count : 1;
+        count = 0;
+        if (c == '$') {
+            row += run;
+            col = 0;
+            continue;
+        }
+
+        int state;
+        if (c == 'b' || c == '.') state = 0;
+        else if (c == 'o') state = 1;
+        else if (c >= 'A' && c <= 'X') state = prefix * 24 + (c - 'A' + 1);
+        else continue; // Caractère inconnu ignoré
+        prefix = 0;
+
+        if ((state == 1 || state == 2) && row < rows && col < cols) {
+            int length = static_cast<int>(col + run <= cols ? run : cols - col);
+            (state == 1 ? pattern.alive : pattern.obstacles).setRun(static_cast<int>(row), static_cast<int>(col), length);
+        }
+        col += run;
+    }
+    return pattern;
+}
+
+// Écrit un motif dans un fichier RLE
+void RLE::write(const string& filename, const Pattern& pattern) {
+    ofstream file(filename, ios::binary | ios::trunc);
+    if (!file.is_open()) {
+        throw runtime_error("Impossible de créer le fichier RLE.");
+    }
+    write(file, pattern);
+}
+
+// Écrit un motif au format RLE dans un flux
+void RLE::write(ostream& out, const Pattern& pattern) {
+    int rows = pattern.alive.getRows();
+    int cols = pattern.alive.getCols();
+    bool multiState = pattern.obstacles.getRows() == rows && pattern.obstacles.getCols() == cols && pattern.obstacles.any();
+    const char deadTag = multiState ? '.' : 'b';
+    const char aliveTag = multiState ? 'A' : 'o';
+
+    out << "x = " << cols << ", y = " << rows << ", rule = " << pattern.rule.toString() << "\n";
+
+    RLEOutput output(out);
+    long long pendingRows = 0; // Fins de ligne en attente (lignes vides comprises)
+    for (int i = 0; i < rows; ++i) {
+        const uint64_t* alive = pattern.alive.rowData(i);
+        const uint64_t* obstacles = multiState ? pattern.obstacles.rowData(i) : nullptr;
+        int col = 0;
+        while (col < cols) {
+            bool isAlive = (alive[col >> 6] >> (col & 63)) & 1;
+            bool isObstacle = obstacles && ((obstacles[col >> 6] >> (col & 63)) & 1);
+            int next = nextChange(alive, obstacles, col, cols, isAlive, isObstacle);
+            if (!isAlive && !isObstacle && next == cols) break; // Cellules vides en fin de ligne omises
+            if (pendingRows > 0) {
+                output.item(pendingRows, '$');
+                pendingRows = 0;
+            }
+            output.item(next - col, isObstacle ? 'B' : (isAlive ? aliveTag : deadTag));
+            col = next;
+        }
+        pendingRows++;
+    }
+    output.item(1, '!');
+    output.flush();
+    out << "\n";
+}
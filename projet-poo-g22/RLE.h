@@ -0,0 +1,67 @@
+// components/RLE.h
+#ifndef RLE_H
+#define RLE_H
+
+#include "BitPlane.h"
+#include "Rule.h"
+#include <string>
+#include <ostream>
+#include <cstddef>
+
+/**
+ * @brief Motif lu ou écrit dans un fichier : cellules vivantes, obstacles et règle.
+ */
+struct Pattern {
+    BitPlane alive;
+    BitPlane obstacles;
+    Rule rule;
+};
+
+/**
+ * @brief Lecture et écriture du format RLE (« x = , y = , rule = »).
+ *
+ * La lecture projette le fichier en mémoire et remplit directement les plans
+ * de bits, sans chaîne intermédiaire. Les obstacles, absents du format
+ * standard, sont écrits avec les lettres multi-états : « . » vide, « A »
+ * vivant, « B » obstacle.
+ */
+class RLE {
+public:
+    /**
+     * @brief Lit un fichier RLE.
+     *
+     * @param filename Nom du fichier.
+     * @return Pattern Motif lu.
+     * @throws std::runtime_error Si le fichier ne peut pas être ouvert ou est invalide.
+     */
+    static Pattern read(const std::string& filename);
+
+    /**
+     * @brief Analyse un contenu RLE en mémoire.
+     *
+     * @param data Début du contenu.
+     * @param size Taille du contenu en octets.
+     * @return Pattern Motif lu.
+     * @throws std::runtime_error Si l'en-tête est absent ou invalide, ou si le motif dépasse 2^28 cellules.
+     */
+    static Pattern parse(const char* data, std::size_t size);
+
+    /**
+     * @brief Écrit un motif dans un fichier RLE.
+     *
+     * @param filename Nom du fichier.
+     * @param pattern Motif à écrire.
+     * @throws std::runtime_error Si le fichier ne peut pas être créé.
+     */
+    static void write(const std::string& filename, const Pattern& pattern);
+
+    /**
+     * @brief Écrit un motif au format RLE dans un flux.
+     *
+     * @param out Flux de sortie.
+     * @param pattern Motif à écrire.
+     */
+    static void write(std::ostream& out, const Pattern& pattern);
+};
+
+#endif // RLE_H
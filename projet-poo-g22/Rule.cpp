@@ -0,0 +1,58 @@
+// components/Rule.cpp
+#include "Rule.h"
+#include <stdexcept>
+#include <cctype>
+
+using namespace std;
+
+// Analyse une règle au format « B3/S23 » ou « 23/3 »
+Rule Rule::parse(const string& text) {
+    Rule rule;
+    rule.birth = 0;
+    rule.survival = 0;
+
+    string body = text.substr(0, text.find(':')); // Ignorer le suffixe de topologie
+    size_t slash = body.find('/');
+    if (slash == string::npos) {
+        throw runtime_error("Règle invalide : " + text);
+    }
+    string first = body.substr(0, slash);
+    string second = body.substr(slash + 1);
+
+    // Format B/S si les parties sont préfixées, sinon format historique S/B
+    bool prefixed = !first.empty() && (first[0] == 'B' || first[0] == 'b' || first[0] == 'S' || first[0] == 's');
+    string parts[2] = { first, second };
+    for (int p = 0; p < 2; ++p) {
+        const string& part = parts[p];
+        bool isBirth = p == 1;
+        size_t start = 0;
+        if (prefixed) {
+            char prefix = part.empty() ? '\0' : static_cast<char>(toupper(static_cast<unsigned char>(part[0])));
+            if (prefix != 'B' && prefix != 'S') {
+                throw runtime_error("Règle invalide : " + text);
+            }
+            isBirth = prefix == 'B';
+            start = 1;
+        }
+        for (size_t i = start; i < part.size(); ++i) {
+            if (part[i] < '0' || part[i] > '8') {
+                throw runtime_error("Règle invalide : " + text);
+            }
+            (isBirth ? rule.birth : rule.survival) |= 1u << (part[i] - '0');
+        }
+    }
+    return rule;
+}
+
+// Retourne la règle au format « B3/S23 »
+string Rule::toString() const {
+    string text = "B";
+    for (int n = 0; n <= 8; ++n) {
+        if (isBorn(n)) text += static_cast<char>('0' + n);
+    }
+    text += "/S";
+    for (int n = 0; n <= 8; ++n) {
+        if (survives(n)) text += static_cast<char>('0' + n);
+    }
+    return text;
+}
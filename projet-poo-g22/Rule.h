@@ -0,0 +1,59 @@
+// components/Rule.h
+#ifndef RULE_H
+#define RULE_H
+
+#include <string>
+
+/**
+ * @brief Règle de naissance et de survie d'un automate de type « Life ».
+ *
+ * Chaque ensemble est un masque de bits indexé par le nombre de voisins
+ * vivants (0 à 8). La règle par défaut est celle de Conway, B3/S23.
+ */
+class Rule {
+public:
+    /**
+     * @brief Construit la règle de Conway (B3/S23).
+     */
+    Rule() : birth(1 << 3), survival((1 << 2) | (1 << 3)) {}
+
+    /**
+     * @brief Construit une règle à partir de ses masques.
+     *
+     * @param birthMask Bit n : une cellule vide à n voisins naît.
+     * @param survivalMask Bit n : une cellule vivante à n voisins survit.
+     */
+    Rule(unsigned birthMask, unsigned survivalMask) : birth(birthMask & 0x1FF), survival(survivalMask & 0x1FF) {}
+
+    /**
+     * @brief Analyse une règle au format « B3/S23 » ou « 23/3 » (survie/naissance).
+     *
+     * Un suffixe de topologie (« :T100,100 ») est ignoré.
+     *
+     * @param text Règle à analyser.
+     * @return Rule Règle correspondante.
+     * @throws std::runtime_error Si la règle est invalide.
+     */
+    static Rule parse(const std::string& text);
+
+    /**
+     * @brief Retourne la règle au format « B3/S23 ».
+     */
+    std::string toString() const;
+
+    bool isBorn(int livingNeighbors) const { return (birth >> livingNeighbors) & 1; }
+    bool survives(int livingNeighbors) const { return (survival >> livingNeighbors) & 1; }
+
+    // Getters
+    unsigned getBirthMask() const { return birth; }
+    unsigned getSurvivalMask() const { return survival; }
+
+    bool operator==(const Rule& other) const { return birth == other.birth && survival == other.survival; }
+    bool operator!=(const Rule& other) const { return !(*this == other); }
+
+private:
+    unsigned birth;    // Bit n : une cellule vide à n voisins naît
+    unsigned survival; // Bit n : une cellule vivante à n voisins survit
+};
+
+#endif // RULE_H
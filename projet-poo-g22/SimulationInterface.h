@@ -7,7 +7,7 @@
 /**
  * @brief Classe de base abstraite pour les interfaces de simulation.
  *
- * Cette classe dfinit une interface commune pour diffrentes implmentations
+ * Cette classe définit une interface commune pour différentes implémentations
  * de l'interface utilisateur de la simulation (console, graphique, etc.).
  */
 class SimulationInterface {
@@ -15,11 +15,11 @@ public:
     virtual ~SimulationInterface() = default;
 
     /**
-     * @brief Excute la simulation.
+     * @brief Exécute la simulation.
      *
-     * @param grid Rfrence vers la grille de simulation.
-     * @param delay Dlai entre chaque itration en millisecondes.
-     * @param maxIterations Nombre maximal d'itrations (0 pour infini).
+     * @param grid Référence vers la grille de simulation.
+     * @param delay Délai entre chaque itération en millisecondes.
+     * @param maxIterations Nombre maximal d'itérations (0 pour infini).
      */
     virtual void run(Grid& grid, int delay, int maxIterations) = 0;
 };
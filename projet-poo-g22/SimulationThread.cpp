@@ -0,0 +1,168 @@
+// components/SimulationThread.cpp
+#include "SimulationThread.h"
+#include "Trace.h"
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+const chrono::microseconds FRAME_BUDGET(16667); // Temps de calcul entre deux images en vitesse maximale
+const int MAX_CATCH_UP = 8; // Générations rattrapées au plus avant de publier une image
+
+} // namespace
+
+SimulationThread::SimulationThread(Grid& simulated, int delay, int iterations)
+    : grid(simulated), maxIterations(iterations), iterationsCount(0), rate(delay > 0 ? 1000.0 / delay : 0.0),
+      running(false), stopping(false), requested(0), settled(0) {
+    publish(); // Image initiale, disponible avant le premier affichage
+    worker = thread(&SimulationThread::run, this);
+}
+
+SimulationThread::~SimulationThread() {
+    stopping.store(true);
+    notify();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+// Réveille le thread de simulation pour une nouvelle demande
+void SimulationThread::notify() {
+    requested.fetch_add(1);
+    {
+        lock_guard<mutex> lock(wakeMutex); // Évite de perdre le réveil pendant que le thread s'endort
+    }
+    wake.notify_one();
+}
+
+// Démarre ou met en pause la simulation
+void SimulationThread::setRunning(bool value) {
+    running.store(value);
+    notify();
+}
+
+// Change la vitesse (prise en compte sans attendre l'échéance en cours)
+void SimulationThread::setRate(double generationsPerSecond) {
+    rate.store(generationsPerSecond > 0 ? generationsPerSecond : 0);
+    notify();
+}
+
+// Transmet une modification (attend si la file est pleine)
+void SimulationThread::send(const Command& command) {
+    while (!commands.push(command)) {
+        this_thread::yield();
+    }
+    notify();
+}
+
+// Applique les modifications en attente
+bool SimulationThread::applyCommands() {
+    bool changed = false;
+    Command command;
+    while (commands.pop(command)) {
+        switch (command.type) {
+        case Command::DESSINER:
+            grid.stamp(*command.shape, command.row, command.col, command.state); // Une seule modification par motif
+            break;
+        case Command::ANNULER:
+            running.store(false); // Arrêter la simulation
+            grid.undo(); // Restaurer l'état précédent de la grille
+            break;
+        case Command::ALLER_A:
+            if (!running.load()) {
+                grid.seekGeneration(grid.getGeneration() + command.offset); // Parcourir la trajectoire enregistrée
+            }
+            break;
+        case Command::COMPTER:
+            grid.setCounterMode(static_cast<GridSnapshot::Counters>(command.offset)); // Colorer par âge ou activité
+            break;
+        }
+        changed = true;
+    }
+    return changed;
+}
+
+// Calcule une génération et arrête la simulation si elle est terminée
+void SimulationThread::step() {
+    grid.update();
+    iterationsCount++;
+
+    // Vérification si la simulation doit être arrêtée
+    if (maxIterations > 0 && iterationsCount >= maxIterations) {
+        running.store(false); // Arrêter la simulation après le nombre d'itérations maximum
+    }
+    else if (grid.hasStableState()) {
+        running.store(false); // Arrêter la simulation si la grille est stable
+        cout << "La grille a atteint un état stable. Fin de la simulation." << endl;
+    }
+}
+
+// Publie l'état courant de la grille pour l'affichage
+void SimulationThread::publish() {
+    TRACE_SPAN("SimulationThread::publish");
+    Frame& frame = frames.back();
+    frame.snapshot = grid.snapshot();
+    frame.generation = grid.getGeneration();
+    frame.iterations = iterationsCount;
+    frames.publish();
+}
+
+// Boucle de simulation à pas fixe : modifications, générations dues, une publication
+void SimulationThread::run() {
+    Trace::setThreadName("SimulationThread");
+    typedef chrono::steady_clock Clock;
+    Clock::time_point next = Clock::now(); // Échéance de la prochaine génération
+    while (!stopping.load()) {
+        uint64_t seen = requested.load(); // Demandes antérieures à la lecture de la file
+        bool changed = applyCommands();
+        Clock::time_point now = Clock::now();
+
+        if (!running.load()) {
+            if (changed) {
+                publish();
+            }
+            settled.store(seen, memory_order_release);
+            // En pause : dormir jusqu'à la prochaine demande
+            unique_lock<mutex> lock(wakeMutex);
+            wake.wait(lock, [this, seen] { return stopping.load() || requested.load() != seen; });
+            next = Clock::now(); // Première génération dès le démarrage
+            continue;
+        }
+
+        double target = rate.load();
+        if (target <= 0) {
+            // Vitesse maximale : autant de générations que le budget d'une image le permet
+            Clock::time_point end = now + FRAME_BUDGET;
+            do {
+                step();
+            } while (running.load() && !stopping.load() && Clock::now() < end);
+            publish();
+            next = Clock::now();
+            continue;
+        }
+
+        if (now < next) {
+            if (changed) {
+                publish();
+            }
+            // Attente de l'échéance, interrompue par une demande pour l'appliquer aussitôt
+            unique_lock<mutex> lock(wakeMutex);
+            wake.wait_until(lock, next, [this, seen] { return stopping.load() || requested.load() != seen; });
+            continue;
+        }
+
+        // Générations dues depuis la dernière échéance (rattrapage limité)
+        Clock::duration period = chrono::duration_cast<Clock::duration>(chrono::duration<double>(1.0 / target));
+        for (int steps = 0; steps < MAX_CATCH_UP && running.load() && now >= next; ++steps) {
+            step();
+            next += period;
+        }
+        if (now >= next) {
+            next = now + period; // Trop de retard : la simulation ralentit au lieu de s'emballer
+        }
+        publish();
+    }
+}
@@ -0,0 +1,152 @@
+// components/SimulationThread.h
+#ifndef SIMULATIONTHREAD_H
+#define SIMULATIONTHREAD_H
+
+#include "Grid.h"
+#include "Snapshot.h"
+#include "TripleBuffer.h"
+#include "SpscQueue.h"
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <cstdint>
+
+/**
+ * @brief Simulation exécutée sur son propre thread pour l'interface graphique.
+ *
+ * Le thread de simulation est le seul à accéder à la grille pendant
+ * l'exécution. Chaque génération terminée (ou chaque modification) est
+ * publiée dans un triple tampon : l'affichage lit toujours la dernière
+ * image complète sans jamais bloquer la simulation, et une génération
+ * lente ne gèle plus la fenêtre. Les modifications de l'utilisateur sont
+ * transmises par une file sans verrou et appliquées entre deux générations.
+ *
+ * Les générations sont cadencées à pas fixe (getRate() générations par
+ * seconde, indépendamment de leur durée de calcul). En vitesse maximale,
+ * le thread calcule autant de générations que le permet le budget d'une
+ * image (1/60 s) puis publie une seule image ; les modifications restent
+ * donc appliquées en moins d'une image quelle que soit la vitesse.
+ *
+ * En pause, le thread de simulation dort jusqu'à la prochaine demande
+ * (modification ou démarrage) ; isSettled() indique à l'affichage que
+ * toutes les demandes ont été traitées et publiées.
+ */
+class SimulationThread {
+public:
+    /**
+     * @brief Image publiée pour l'affichage.
+     */
+    struct Frame {
+        GridSnapshot snapshot;
+        long long generation = 0;
+        int iterations = 0; // Générations calculées depuis le début
+    };
+
+    /**
+     * @brief Modification demandée par l'interface.
+     */
+    struct Command {
+        enum Type {
+            DESSINER, // Appliquer un motif (pinceau ou construction) à partir de (row, col)
+            ANNULER,  // Revenir à l'état précédent
+            ALLER_A,  // Revenir à une génération de la trajectoire
+            COMPTER   // Changer les compteurs par cellule (offset : GridSnapshot::Counters)
+        };
+
+        Type type;
+        int row;
+        int col;
+        CellState state;
+        long long offset; // Décalage de génération (ALLER_A) ou compteurs (COMPTER)
+        std::shared_ptr<const BitPlane> shape; // Motif à appliquer (DESSINER)
+    };
+
+    /**
+     * @brief Démarre le thread de simulation (simulation en pause).
+     *
+     * @param grid Grille simulée ; elle ne doit plus être utilisée ailleurs jusqu'à la destruction.
+     * @param delay Délai entre deux générations en millisecondes (0 : vitesse maximale).
+     * @param maxIterations Nombre maximal d'itérations (0 pour infini).
+     */
+    SimulationThread(Grid& grid, int delay, int maxIterations);
+
+    /**
+     * @brief Arrête et attend le thread de simulation.
+     */
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    /**
+     * @brief Démarre ou met en pause la simulation.
+     */
+    void setRunning(bool value);
+
+    /**
+     * @brief Vérifie si la simulation est en cours (elle s'arrête seule à la fin ou si elle est stable).
+     */
+    bool isRunning() const { return running.load(); }
+
+    /**
+     * @brief Vérifie si la simulation est en pause et a publié le résultat de toutes les demandes.
+     *
+     * Dans ce cas, aucune nouvelle image n'arrivera avant la prochaine demande.
+     */
+    bool isSettled() const { return !running.load() && settled.load(std::memory_order_acquire) == requested.load(); }
+
+    /**
+     * @brief Change la vitesse de la simulation.
+     *
+     * @param generationsPerSecond Générations par seconde (0 : vitesse maximale).
+     */
+    void setRate(double generationsPerSecond);
+
+    /**
+     * @brief Retourne la vitesse cible en générations par seconde (0 : vitesse maximale).
+     */
+    double getRate() const { return rate.load(); }
+
+    /**
+     * @brief Transmet une modification au thread de simulation.
+     */
+    void send(const Command& command);
+
+    /**
+     * @brief Récupère la dernière image publiée.
+     *
+     * @return true Si une nouvelle image est disponible dans frame().
+     */
+    bool poll() { return frames.update(); }
+
+    /**
+     * @brief Dernière image récupérée par poll().
+     */
+    const Frame& frame() const { return frames.front(); }
+
+private:
+    Grid& grid;
+    int maxIterations;
+    int iterationsCount; // Propriété du thread de simulation
+    std::atomic<double> rate;
+    std::atomic<bool> running;
+    std::atomic<bool> stopping;
+    std::atomic<std::uint64_t> requested; // Demandes envoyées par l'interface
+    std::atomic<std::uint64_t> settled; // Demandes traitées et publiées
+    std::mutex wakeMutex;
+    std::condition_variable wake; // Réveille le thread de simulation
+
+    TripleBuffer<Frame> frames;
+    SpscQueue<Command, 1024> commands;
+    std::thread worker;
+
+    void notify();
+    void run();
+    bool applyCommands();
+    void step();
+    void publish();
+};
+
+#endif // SIMULATIONTHREAD_H
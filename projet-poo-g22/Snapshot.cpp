@@ -0,0 +1,202 @@
+// components/Snapshot.cpp
+#include "Snapshot.h"
+#include <algorithm>
+#include <cstring>
+#include <atomic>
+
+using namespace std;
+
+namespace {
+
+atomic<uint64_t> lastVersion(0); // Versions uniques pour toutes les grilles
+
+// Capture une tuile d'un plan à plat (cellules ou compteurs)
+// Retourne previous si la zone est identique à son contenu, nullptr si toutes ses valeurs sont nulles
+template <typename T>
+GridSnapshot::TilePtr captureValues(const vector<T>& values, int rows, int cols, int tileRow, int tileCol,
+                                    const GridSnapshot::TilePtr& previous) {
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    int top = tileRow * tileSize;
+    int left = tileCol * tileSize;
+    int height = min(tileSize, rows - top);
+    int width = min(tileSize, cols - left);
+
+    // Un seul parcours : arrêt dès que la zone n'est ni vide ni identique à previous
+    bool empty = true;
+    bool same = previous != nullptr;
+    for (int i = 0; i < height && (empty || same); ++i) {
+        const T* row = &values[static_cast<size_t>(top + i) * cols + left];
+        const unsigned char* old = same ? &previous->cells[i * tileSize] : nullptr;
+        for (int j = 0; j < width; ++j) {
+            empty = empty && row[j] == 0;
+            same = same && static_cast<unsigned char>(row[j]) == old[j];
+            if (!empty && !same) {
+                break;
+            }
+        }
+    }
+    if (same) {
+        return previous; // Tuile marquée mais inchangée : elle reste partagée
+    }
+    if (empty) {
+        return nullptr; // Une tuile vide n'est jamais allouée
+    }
+
+    shared_ptr<GridSnapshot::Tile> tile = make_shared<GridSnapshot::Tile>();
+    memset(tile->cells, 0, sizeof(tile->cells));
+    for (int i = 0; i < height; ++i) {
+        const T* row = &values[static_cast<size_t>(top + i) * cols + left];
+        unsigned char* dst = &tile->cells[i * tileSize];
+        for (int j = 0; j < width; ++j) {
+            dst[j] = static_cast<unsigned char>(row[j]);
+        }
+    }
+    return tile;
+}
+
+// Recopie une tuile dans un plan à plat (cellules ou compteurs)
+template <typename T>
+void restoreValues(const GridSnapshot::Tile& tile, vector<T>& values, int rows, int cols, int tileRow, int tileCol) {
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    int top = tileRow * tileSize;
+    int left = tileCol * tileSize;
+    int height = min(tileSize, rows - top);
+    int width = min(tileSize, cols - left);
+    for (int i = 0; i < height; ++i) {
+        T* row = &values[static_cast<size_t>(top + i) * cols + left];
+        const unsigned char* src = &tile.cells[i * tileSize];
+        for (int j = 0; j < width; ++j) {
+            row[j] = static_cast<T>(src[j]);
+        }
+    }
+}
+
+} // namespace
+
+GridSnapshot::GridSnapshot() : rows(0), cols(0), tileRows(0), tileCols(0), counters(AUCUN), version(0), baseVersion(0) {}
+
+GridSnapshot::GridSnapshot(int r, int c)
+    : rows(r), cols(c),
+      tileRows((r + TILE_SIZE - 1) / TILE_SIZE),
+      tileCols((c + TILE_SIZE - 1) / TILE_SIZE),
+      counters(AUCUN), version(0), baseVersion(0) {
+    tiles.assign(static_cast<size_t>(tileRows) * tileCols, emptyTile());
+}
+
+const GridSnapshot::TilePtr& GridSnapshot::emptyTile() {
+    static const TilePtr empty = [] {
+        shared_ptr<Tile> tile = make_shared<Tile>();
+        memset(tile->cells, VIDE, sizeof(tile->cells));
+        return TilePtr(tile);
+    }();
+    return empty;
+}
+
+// Change la signification des compteurs (tous nuls)
+void GridSnapshot::setCounters(Counters mode) {
+    counters = mode;
+    if (mode == AUCUN) {
+        counterTiles.clear();
+    }
+    else {
+        counterTiles.assign(tiles.size(), emptyTile());
+    }
+    version = 0;
+    changes.reset();
+}
+
+// Attribue une nouvelle version après des appels à setTile()
+void GridSnapshot::recordChanges(uint64_t base, vector<int> changedTiles) {
+    version = ++lastVersion;
+    baseVersion = base;
+    changes = make_shared<const vector<int>>(move(changedTiles));
+}
+
+// Tuiles différentes de previous : liste enregistrée si previous est la version précédente, comparaison sinon
+void GridSnapshot::changedTiles(const GridSnapshot& previous, vector<int>& changedTiles) const {
+    changedTiles.clear();
+    if (version != 0 && version == previous.version) {
+        return; // Même contenu
+    }
+    if (version != 0 && changes && baseVersion != 0 && baseVersion == previous.version) {
+        changedTiles = *changes;
+        return;
+    }
+    bool sameCounters = counters == previous.counters;
+    for (int t = 0; t < tileRows * tileCols; ++t) {
+        if (!sameCounters || tiles[t] != previous.tiles[t] ||
+            (!counterTiles.empty() && counterTiles[t] != previous.counterTiles[t])) {
+            changedTiles.push_back(t);
+        }
+    }
+}
+
+// Capture une tuile à partir de la grille à plat
+GridSnapshot::TilePtr GridSnapshot::capture(const vector<CellState>& cells, int rows, int cols, int tileRow, int tileCol,
+                                             const TilePtr& previous) {
+    static_assert(VIDE == 0, "La tuile vide partagée suppose VIDE == 0");
+    TilePtr tile = captureValues(cells, rows, cols, tileRow, tileCol, previous);
+    return tile ? tile : emptyTile();
+}
+
+// Capture une tuile de compteurs
+GridSnapshot::TilePtr GridSnapshot::captureCounters(const vector<unsigned char>& counters, int rows, int cols, int tileRow,
+                                                     int tileCol, const TilePtr& previous) {
+    TilePtr tile = captureValues(counters, rows, cols, tileRow, tileCol, previous);
+    return tile ? tile : emptyTile();
+}
+
+// Recopie une tuile dans la grille à plat
+void GridSnapshot::restoreTile(vector<CellState>& cells, int tileRow, int tileCol) const {
+    restoreValues(*getTile(tileRow, tileCol), cells, rows, cols, tileRow, tileCol);
+}
+
+// Recopie une tuile de compteurs dans le plan des compteurs
+void GridSnapshot::restoreCounterTile(vector<unsigned char>& values, int tileRow, int tileCol) const {
+    restoreValues(*getCounterTile(tileRow, tileCol), values, rows, cols, tileRow, tileCol);
+}
+
+// Recopie tout l'instantané dans la grille à plat
+void GridSnapshot::restore(vector<CellState>& cells) const {
+    cells.resize(static_cast<size_t>(rows) * cols);
+    for (int tr = 0; tr < tileRows; ++tr) {
+        for (int tc = 0; tc < tileCols; ++tc) {
+            restoreTile(cells, tr, tc);
+        }
+    }
+}
+
+// Vérifie si une tuile est identique à la zone correspondante de la grille
+bool GridSnapshot::matchesTile(const vector<CellState>& cells, int tileRow, int tileCol) const {
+    const Tile& tile = *getTile(tileRow, tileCol);
+    int top = tileRow * TILE_SIZE;
+    int left = tileCol * TILE_SIZE;
+    int height = min(TILE_SIZE, rows - top);
+    int width = min(TILE_SIZE, cols - left);
+    for (int i = 0; i < height; ++i) {
+        const CellState* row = &cells[static_cast<size_t>(top + i) * cols + left];
+        const unsigned char* src = &tile.cells[i * TILE_SIZE];
+        for (int j = 0; j < width; ++j) {
+            if (row[j] != static_cast<CellState>(src[j])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Nombre d'octets de tuiles référencées par cet instantané
+size_t GridSnapshot::tileBytes() const {
+    size_t bytes = (tiles.size() + counterTiles.size()) * sizeof(TilePtr);
+    for (const TilePtr& tile : tiles) {
+        if (tile != emptyTile()) {
+            bytes += sizeof(Tile);
+        }
+    }
+    for (const TilePtr& tile : counterTiles) {
+        if (tile != emptyTile()) {
+            bytes += sizeof(Tile);
+        }
+    }
+    return bytes;
+}
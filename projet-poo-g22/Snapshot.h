@@ -0,0 +1,213 @@
+// components/Snapshot.h
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "Cellule.h"
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Instantané immuable de la grille découpé en tuiles partagées.
+ *
+ * Chaque tuile est immuable et partagée par comptage de références entre
+ * les instantanés successifs : une nouvelle génération ne réalloue que les
+ * tuiles réellement modifiées, et copier un instantané revient à copier sa
+ * table de tuiles. Les tuiles entièrement vides pointent toutes vers une
+ * unique tuile vide. Cette table est le coût fixe d'un instantané : un
+ * pointeur partagé (16 octets) par tuile, soit environ 1,5 Mo pour une
+ * grille de 20 000 x 20 000 (le double avec des compteurs).
+ *
+ * Les instantanés produits par la grille portent aussi la liste des tuiles
+ * réallouées depuis la version précédente (carte des modifications issue
+ * de la mise à jour). Les consommateurs (affichages, journal delta,
+ * pyramide de densité) l'obtiennent par changedTiles() et ne parcourent
+ * que les zones modifiées.
+ *
+ * En option, un instantané porte aussi des compteurs par cellule (âge ou
+ * activité, sur 8 bits), tenus à jour par la grille pendant le calcul des
+ * générations et découpés en tuiles de la même façon ; les tuiles dont les
+ * compteurs ont changé font partie des tuiles modifiées.
+ */
+class GridSnapshot {
+public:
+    static const int TILE_SIZE = 64; // Côté d'une tuile en cellules
+
+    /**
+     * @brief Bloc de TILE_SIZE x TILE_SIZE cellules (un octet par cellule).
+     *
+     * Les tuiles du bord sont complétées par des cellules VIDE.
+     */
+    struct Tile {
+        unsigned char cells[TILE_SIZE * TILE_SIZE];
+    };
+
+    typedef std::shared_ptr<const Tile> TilePtr;
+
+    /**
+     * @brief Signification des compteurs par cellule.
+     */
+    enum Counters {
+        AUCUN,   // Pas de compteurs
+        AGE,     // Générations vécues par la cellule vivante (0 si elle n'est pas vivante)
+        ACTIVITE // Changements d'état récents (augmente à chaque changement, décroît ensuite)
+    };
+
+    /**
+     * @brief Construit un instantané vide (0 x 0).
+     */
+    GridSnapshot();
+
+    /**
+     * @brief Construit un instantané dont toutes les cellules sont VIDE.
+     *
+     * @param rows Nombre de lignes.
+     * @param cols Nombre de colonnes.
+     */
+    GridSnapshot(int rows, int cols);
+
+    /**
+     * @brief Capture une tuile à partir de la grille à plat.
+     *
+     * @param cells Cellules de la grille, ligne par ligne.
+     * @param rows Nombre de lignes de la grille.
+     * @param cols Nombre de colonnes de la grille.
+     * @param tileRow Ligne de la tuile.
+     * @param tileCol Colonne de la tuile.
+     * @param previous Tuile actuelle à cette position, reprise telle quelle si son contenu n'a pas changé.
+     * @return TilePtr previous si elle est identique, sinon une nouvelle tuile, ou la tuile vide partagée
+     *         si elle ne contient que des cellules VIDE.
+     */
+    static TilePtr capture(const std::vector<CellState>& cells, int rows, int cols, int tileRow, int tileCol,
+                           const TilePtr& previous = TilePtr());
+
+    /**
+     * @brief Capture une tuile de compteurs à partir du plan des compteurs de la grille.
+     *
+     * @return TilePtr previous si elle est identique, sinon une nouvelle tuile, ou la tuile vide partagée
+     *         si tous les compteurs sont nuls.
+     */
+    static TilePtr captureCounters(const std::vector<unsigned char>& counters, int rows, int cols, int tileRow, int tileCol,
+                                   const TilePtr& previous = TilePtr());
+
+    /**
+     * @brief Remplace une tuile de l'instantané.
+     */
+    void setTile(int tileRow, int tileCol, const TilePtr& tile) {
+        tiles[tileRow * tileCols + tileCol] = tile;
+        version = 0; // Contenu modifié : version inconnue jusqu'à recordChanges()
+        changes.reset();
+    }
+
+    /**
+     * @brief Change la signification des compteurs ; toutes les tuiles de compteurs deviennent nulles.
+     */
+    void setCounters(Counters mode);
+
+    /**
+     * @brief Remplace une tuile de compteurs (l'instantané doit porter des compteurs).
+     */
+    void setCounterTile(int tileRow, int tileCol, const TilePtr& tile) {
+        counterTiles[tileRow * tileCols + tileCol] = tile;
+        version = 0;
+        changes.reset();
+    }
+
+    /**
+     * @brief Attribue une nouvelle version après des appels à setTile().
+     *
+     * @param base Version de l'instantané avant les modifications.
+     * @param changedTiles Indices (ligne * colonnes de tuiles + colonne) des tuiles remplacées, dans l'ordre.
+     */
+    void recordChanges(std::uint64_t base, std::vector<int> changedTiles);
+
+    /**
+     * @brief Indices des tuiles qui diffèrent (par pointeur) de celles de previous.
+     *
+     * Si previous est la version précédente de cet instantané, la liste
+     * enregistrée par recordChanges() est reprise telle quelle ; sinon
+     * toutes les tuiles (cellules et compteurs) sont comparées. Si la
+     * signification des compteurs diffère, toutes les tuiles sont listées.
+     * Les indices sont dans l'ordre des lignes. Les deux instantanés
+     * doivent avoir les mêmes dimensions.
+     *
+     * @param previous Instantané de référence.
+     * @param changedTiles Indices des tuiles différentes (remplacé).
+     */
+    void changedTiles(const GridSnapshot& previous, std::vector<int>& changedTiles) const;
+
+    /**
+     * @brief Retourne une tuile de l'instantané.
+     */
+    const TilePtr& getTile(int tileRow, int tileCol) const { return tiles[tileRow * tileCols + tileCol]; }
+
+    /**
+     * @brief Retourne une tuile de compteurs (la tuile vide, tous nuls, sans compteurs).
+     */
+    const TilePtr& getCounterTile(int tileRow, int tileCol) const {
+        return counterTiles.empty() ? emptyTile() : counterTiles[tileRow * tileCols + tileCol];
+    }
+
+    /**
+     * @brief Recopie une tuile dans la grille à plat.
+     *
+     * @param cells Cellules de destination, de dimensions getRows() x getCols().
+     * @param tileRow Ligne de la tuile.
+     * @param tileCol Colonne de la tuile.
+     */
+    void restoreTile(std::vector<CellState>& cells, int tileRow, int tileCol) const;
+
+    /**
+     * @brief Recopie une tuile de compteurs dans le plan des compteurs de la grille.
+     */
+    void restoreCounterTile(std::vector<unsigned char>& counters, int tileRow, int tileCol) const;
+
+    /**
+     * @brief Recopie tout l'instantané dans la grille à plat.
+     *
+     * @param cells Cellules de destination, redimensionnées si nécessaire.
+     */
+    void restore(std::vector<CellState>& cells) const;
+
+    /**
+     * @brief Vérifie si une tuile est identique à la zone correspondante de la grille.
+     */
+    bool matchesTile(const std::vector<CellState>& cells, int tileRow, int tileCol) const;
+
+    /**
+     * @brief Nombre d'octets de tuiles référencées par cet instantané (hors tuile vide).
+     *
+     * Les tuiles partagées avec d'autres instantanés sont comptées entièrement.
+     */
+    std::size_t tileBytes() const;
+
+    /**
+     * @brief Retourne la tuile vide partagée par tous les instantanés.
+     *
+     * Une tuile égale (même pointeur) à celle-ci ne contient que des cellules VIDE.
+     */
+    static const TilePtr& emptyTile();
+
+    // Getters
+    int getRows() const { return rows; }
+    int getCols() const { return cols; }
+    int getTileRows() const { return tileRows; }
+    int getTileCols() const { return tileCols; }
+    std::uint64_t getVersion() const { return version; }
+    Counters getCounters() const { return counters; }
+
+private:
+    int rows;
+    int cols;
+    int tileRows;
+    int tileCols;
+    std::vector<TilePtr> tiles;
+    Counters counters;
+    std::vector<TilePtr> counterTiles; // Vide sans compteurs
+    std::uint64_t version; // Identifiant du contenu (0 : inconnu)
+    std::uint64_t baseVersion; // Version dont dérive celle-ci
+    std::shared_ptr<const std::vector<int>> changes; // Tuiles remplacées depuis baseVersion
+};
+
+#endif // SNAPSHOT_H
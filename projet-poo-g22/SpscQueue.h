@@ -0,0 +1,64 @@
+// components/SpscQueue.h
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @brief File bornée sans verrou entre un producteur et un consommateur.
+ *
+ * Chaque indice n'est modifié que par un seul thread ; les deux sont placés
+ * sur des lignes de cache différentes pour que le producteur et le
+ * consommateur ne se gênent pas.
+ *
+ * @tparam Capacity Nombre d'emplacements (puissance de deux).
+ */
+template <typename T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacité en puissance de deux attendue");
+
+public:
+    SpscQueue() : head(0), tail(0) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief Ajoute un élément (producteur uniquement).
+     *
+     * @return false Si la file est pleine.
+     */
+    bool push(const T& item) {
+        std::size_t position = tail.load(std::memory_order_relaxed);
+        if (position - head.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        items[position & (Capacity - 1)] = item;
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Retire le plus ancien élément (consommateur uniquement).
+     *
+     * @return false Si la file est vide.
+     */
+    bool pop(T& item) {
+        std::size_t position = head.load(std::memory_order_relaxed);
+        if (position == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = std::move(items[position & (Capacity - 1)]); // Ne garde pas de ressource dans la file
+        head.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    T items[Capacity];
+    alignas(64) std::atomic<std::size_t> head; // Prochain élément à lire (consommateur)
+    alignas(64) std::atomic<std::size_t> tail; // Prochain emplacement à écrire (producteur)
+};
+
+#endif // SPSCQUEUE_H
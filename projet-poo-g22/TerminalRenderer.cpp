@@ -0,0 +1,410 @@
+// interfaces/TerminalRenderer.cpp
+#include "TerminalRenderer.h"
+#include "Trace.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <io.h>
+#include <conio.h>
+#else
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+// Couleurs des caractères
+enum Color : unsigned char {
+    DEFAUT, // Hors de la grille
+    NOIR,   // Cellule vide
+    BLANC,  // Cellule vivante
+    ROUGE   // Obstacle
+};
+
+const char* const FOREGROUND[4] = { "39", "30", "97", "31" };
+const char* const BACKGROUND[4] = { "49", "40", "107", "41" };
+
+const uint32_t HALF_BLOCK = 0x2580; // Demi-bloc supérieur : moitié haute en premier plan, basse en fond
+const uint32_t BRAILLE_BASE = 0x2800;
+const uint32_t UNKNOWN = 0xFFFFFFFF; // Caractère jamais affiché (image à redessiner)
+
+// Point braille de chaque cellule d'un bloc de 4 lignes x 2 colonnes
+const unsigned char BRAILLE_DOTS[4][2] = {
+    { 0x01, 0x08 },
+    { 0x02, 0x10 },
+    { 0x04, 0x20 },
+    { 0x40, 0x80 }
+};
+
+unsigned char stateAt(const GridSnapshot& snapshot, long long row, long long col) {
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    const GridSnapshot::TilePtr& tile = snapshot.getTile(static_cast<int>(row / tileSize), static_cast<int>(col / tileSize));
+    return tile->cells[(row % tileSize) * tileSize + col % tileSize] & 3;
+}
+
+unsigned char colorOf(unsigned char state) {
+    return state == VIVANT ? BLANC : state == OBSTACLE ? ROUGE : NOIR;
+}
+
+void appendNumber(string& buffer, long long value) {
+    char digits[24];
+    int length = snprintf(digits, sizeof(digits), "%lld", value);
+    buffer.append(digits, static_cast<size_t>(length));
+}
+
+void appendUtf8(string& buffer, uint32_t codepoint) {
+    if (codepoint < 0x80) {
+        buffer += static_cast<char>(codepoint);
+    }
+    else if (codepoint < 0x800) {
+        buffer += static_cast<char>(0xC0 | (codepoint >> 6));
+        buffer += static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+    else {
+        buffer += static_cast<char>(0xE0 | (codepoint >> 12));
+        buffer += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        buffer += static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+}
+
+void moveCursor(string& buffer, int row, int col) {
+    buffer += "\x1b[";
+    appendNumber(buffer, row + 1);
+    buffer += ';';
+    appendNumber(buffer, col + 1);
+    buffer += 'H';
+}
+
+// Taille de la fenêtre du terminal (80 x 24 si elle ne peut pas être lue)
+void terminalSize(int& width, int& height) {
+    width = 80;
+    height = 24;
+#ifdef _WIN32
+    CONSOLE_SCREEN_BUFFER_INFO info;
+    if (GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &info)) {
+        width = info.srWindow.Right - info.srWindow.Left + 1;
+        height = info.srWindow.Bottom - info.srWindow.Top + 1;
+    }
+#else
+    winsize size;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && size.ws_col > 0 && size.ws_row > 0) {
+        width = size.ws_col;
+        height = size.ws_row;
+    }
+#endif
+}
+
+#ifdef _WIN32
+// Active les séquences ANSI et l'UTF-8 de la console (restaurés par restoreConsole)
+UINT savedCodePage = 0;
+
+void prepareConsole() {
+    HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD mode = 0;
+    if (GetConsoleMode(output, &mode)) {
+        SetConsoleMode(output, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+    }
+    savedCodePage = GetConsoleOutputCP();
+    SetConsoleOutputCP(CP_UTF8);
+}
+
+void restoreConsole() {
+    if (savedCodePage != 0) {
+        SetConsoleOutputCP(savedCodePage);
+    }
+}
+#else
+void prepareConsole() {}
+void restoreConsole() {}
+#endif
+
+} // namespace
+
+TerminalRenderer::TerminalRenderer(Mode requested, int terminalWidth, int terminalHeight)
+    : requestedMode(requested), mode(requested), width(terminalWidth), height(terminalHeight), glyphRows(0), glyphCols(0),
+      cellWidth(1), cellHeight(2), top(0), left(0), gridRows(-1), gridCols(-1), active(false) {
+    if (width <= 0 || height <= 0) {
+        terminalSize(width, height);
+    }
+    height = max(2, height);
+    width = max(1, width);
+}
+
+TerminalRenderer::~TerminalRenderer() {
+    finish();
+}
+
+// Vérifie si la sortie standard est un terminal
+bool TerminalRenderer::isTerminal() {
+#ifdef _WIN32
+    return _isatty(_fileno(stdout)) != 0;
+#else
+    return isatty(STDOUT_FILENO) != 0;
+#endif
+}
+
+// Choisit le regroupement des cellules et la taille de la fenêtre pour une grille
+void TerminalRenderer::layout(int rows, int cols) {
+    int availableRows = height - 1; // Dernière ligne réservée à l'état
+    Mode chosen = requestedMode;
+    if (chosen == AUTO) {
+        bool fits = rows <= 2LL * availableRows && cols <= width;
+        chosen = fits ? DEMI_BLOCS : BRAILLE;
+    }
+    cellWidth = chosen == BRAILLE ? 2 : 1;
+    cellHeight = chosen == BRAILLE ? 4 : 2;
+
+    int neededRows = static_cast<int>((static_cast<long long>(rows) + cellHeight - 1) / cellHeight);
+    int neededCols = static_cast<int>((static_cast<long long>(cols) + cellWidth - 1) / cellWidth);
+    int newRows = min(availableRows, neededRows);
+    int newCols = min(width, neededCols);
+    if (chosen != mode || newRows != glyphRows || newCols != glyphCols || rows != gridRows || cols != gridCols) {
+        active = false; // Disposition modifiée : tout l'écran est redessiné
+    }
+    mode = chosen;
+    glyphRows = newRows;
+    glyphCols = newCols;
+    gridRows = rows;
+    gridCols = cols;
+    scroll(0, 0); // Recadre la fenêtre dans la grille
+}
+
+// Fait défiler la fenêtre d'affichage
+void TerminalRenderer::scroll(long long rows, long long cols) {
+    long long maxTop = max(0LL, static_cast<long long>(gridRows) - getViewRows());
+    long long maxLeft = max(0LL, static_cast<long long>(gridCols) - getViewCols());
+    top = min(max(0LL, top + rows), maxTop);
+    left = min(max(0LL, left + cols), maxLeft);
+}
+
+// Caractère représentant un bloc de cellules à partir de (row, col)
+TerminalRenderer::Glyph TerminalRenderer::glyphAt(const GridSnapshot& snapshot, long long row, long long col) const {
+    Glyph glyph;
+    if (mode == BRAILLE) {
+        unsigned dots = 0;
+        bool obstacle = false;
+        for (int i = 0; i < 4 && row + i < gridRows; ++i) {
+            for (int j = 0; j < 2 && col + j < gridCols; ++j) {
+                unsigned char state = stateAt(snapshot, row + i, col + j);
+                if (state == VIVANT || state == OBSTACLE) {
+                    dots |= BRAILLE_DOTS[i][j];
+                    obstacle = obstacle || state == OBSTACLE;
+                }
+            }
+        }
+        glyph.codepoint = dots ? BRAILLE_BASE + dots : ' ';
+        glyph.foreground = !dots ? DEFAUT : obstacle ? ROUGE : BLANC;
+        glyph.background = NOIR;
+        return glyph;
+    }
+
+    unsigned char upper = colorOf(stateAt(snapshot, row, col));
+    unsigned char lower = row + 1 < gridRows ? colorOf(stateAt(snapshot, row + 1, col)) : static_cast<unsigned char>(DEFAUT);
+    if (upper == lower) {
+        glyph.codepoint = ' '; // Un espace suffit : seule la couleur de fond compte
+        glyph.foreground = DEFAUT;
+    }
+    else {
+        glyph.codepoint = HALF_BLOCK;
+        glyph.foreground = upper;
+    }
+    glyph.background = lower;
+    return glyph;
+}
+
+// Construit le texte d'une image : seuls les caractères modifiés depuis la précédente sont émis
+string TerminalRenderer::frame(const GridSnapshot& snapshot, long long generation) {
+    layout(snapshot.getRows(), snapshot.getCols());
+
+    string out;
+    size_t glyphCount = static_cast<size_t>(glyphRows) * glyphCols;
+    if (!active) {
+        out += "\x1b[?25l\x1b[0m\x1b[2J"; // Curseur masqué, écran effacé
+        Glyph unknown = { UNKNOWN, DEFAUT, DEFAUT };
+        previous.assign(glyphCount, unknown);
+        status.clear();
+        active = true;
+    }
+
+    int cursorRow = -1; // Position et couleurs courantes du terminal (-1 : inconnues)
+    int cursorCol = -1;
+    int foreground = -1;
+    int background = -1;
+    for (int r = 0; r < glyphRows; ++r) {
+        long long row = top + static_cast<long long>(r) * cellHeight;
+        for (int c = 0; c < glyphCols; ++c) {
+            long long col = left + static_cast<long long>(c) * cellWidth;
+            Glyph glyph = glyphAt(snapshot, row, col);
+            Glyph& before = previous[static_cast<size_t>(r) * glyphCols + c];
+            if (glyph == before) {
+                continue;
+            }
+            before = glyph;
+
+            if (r != cursorRow || c != cursorCol) {
+                moveCursor(out, r, c);
+            }
+            bool needForeground = glyph.codepoint != ' ' && glyph.foreground != foreground;
+            if (needForeground || glyph.background != background) {
+                out += "\x1b[";
+                if (needForeground) {
+                    out += FOREGROUND[glyph.foreground];
+                    foreground = glyph.foreground;
+                }
+                if (glyph.background != background) {
+                    if (needForeground) out += ';';
+                    out += BACKGROUND[glyph.background];
+                    background = glyph.background;
+                }
+                out += 'm';
+            }
+            appendUtf8(out, glyph.codepoint);
+            cursorRow = r;
+            // Après la dernière colonne, la position du curseur dépend du terminal
+            cursorCol = c + 1 < width ? c + 1 : -1;
+        }
+    }
+
+    // Ligne d'état sous la grille (redessinée seulement si son texte change)
+    string text = "G\xc3\xa9n\xc3\xa9ration ";
+    appendNumber(text, generation);
+    text += " | lignes ";
+    appendNumber(text, top + 1);
+    text += '-';
+    appendNumber(text, min<long long>(gridRows, top + getViewRows()));
+    text += '/';
+    appendNumber(text, gridRows);
+    text += " | colonnes ";
+    appendNumber(text, left + 1);
+    text += '-';
+    appendNumber(text, min<long long>(gridCols, left + getViewCols()));
+    text += '/';
+    appendNumber(text, gridCols);
+    text += " | fl\xc3\xa8" "ches : d\xc3\xa9" "filer, q : quitter";
+    // Coupe le texte à la largeur du terminal (en caractères, pas en octets)
+    int shown = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        if ((static_cast<unsigned char>(text[i]) & 0xC0) != 0x80 && ++shown > width) {
+            text.resize(i);
+            break;
+        }
+    }
+    if (text != status) {
+        status = text;
+        moveCursor(out, glyphRows, 0);
+        out += "\x1b[0m";
+        out += text;
+        out += "\x1b[K";
+    }
+    return out;
+}
+
+// Affiche une génération en une seule écriture
+void TerminalRenderer::render(const GridSnapshot& snapshot, long long generation) {
+    TRACE_SPAN("TerminalRenderer::render");
+    if (!active) {
+        prepareConsole();
+    }
+    string out = frame(snapshot, generation);
+    if (!out.empty()) {
+        fwrite(out.data(), 1, out.size(), stdout);
+        fflush(stdout);
+    }
+}
+
+// Rend la main au terminal : couleurs par défaut, curseur visible sous la ligne d'état
+void TerminalRenderer::finish() {
+    if (!active) {
+        return;
+    }
+    string out;
+    moveCursor(out, glyphRows + 1, 0);
+    out += "\x1b[0m\x1b[?25h";
+    fwrite(out.data(), 1, out.size(), stdout);
+    fflush(stdout);
+    restoreConsole();
+    active = false;
+}
+
+#ifdef _WIN32
+
+TerminalInput::TerminalInput() : raw(true) {}
+
+TerminalInput::~TerminalInput() {}
+
+// Retourne la touche appuyée (les flèches sont précédées de 0 ou 224)
+int TerminalInput::poll() {
+    if (!_kbhit()) {
+        return AUCUNE;
+    }
+    int key = _getch();
+    if (key == 0 || key == 224) {
+        switch (_getch()) {
+        case 72: return HAUT;
+        case 80: return BAS;
+        case 75: return GAUCHE;
+        case 77: return DROITE;
+        default: return AUCUNE;
+        }
+    }
+    return key;
+}
+
+#else
+
+// Mode non canonique sans écho ; read() retourne immédiatement (VMIN = VTIME = 0)
+TerminalInput::TerminalInput() : raw(false) {
+    termios settings;
+    if (!isatty(STDIN_FILENO) || tcgetattr(STDIN_FILENO, &settings) != 0) {
+        return;
+    }
+    saved.resize(sizeof(settings));
+    memcpy(saved.data(), &settings, sizeof(settings));
+    settings.c_lflag &= ~(ICANON | ECHO);
+    settings.c_cc[VMIN] = 0;
+    settings.c_cc[VTIME] = 0;
+    raw = tcsetattr(STDIN_FILENO, TCSANOW, &settings) == 0;
+}
+
+TerminalInput::~TerminalInput() {
+    if (raw) {
+        termios settings;
+        memcpy(&settings, saved.data(), sizeof(settings));
+        tcsetattr(STDIN_FILENO, TCSANOW, &settings);
+    }
+}
+
+// Retourne la touche appuyée (les flèches arrivent sous la forme ESC [ A/B/C/D)
+int TerminalInput::poll() {
+    if (!raw) {
+        return AUCUNE;
+    }
+    unsigned char key;
+    if (read(STDIN_FILENO, &key, 1) != 1) {
+        return AUCUNE;
+    }
+    if (key != 27) {
+        return key;
+    }
+    unsigned char sequence[2];
+    if (read(STDIN_FILENO, &sequence[0], 1) != 1 || sequence[0] != '[' || read(STDIN_FILENO, &sequence[1], 1) != 1) {
+        return key;
+    }
+    switch (sequence[1]) {
+    case 'A': return HAUT;
+    case 'B': return BAS;
+    case 'D': return GAUCHE;
+    case 'C': return DROITE;
+    default: return AUCUNE;
+    }
+}
+
+#endif
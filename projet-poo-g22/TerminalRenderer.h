@@ -0,0 +1,149 @@
+// interfaces/TerminalRenderer.h
+#ifndef TERMINALRENDERER_H
+#define TERMINALRENDERER_H
+
+#include "Snapshot.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief Affichage de la grille dans un terminal ANSI, par différences.
+ *
+ * L'image précédente est conservée : chaque appel à render() n'émet que
+ * les déplacements du curseur et les caractères qui ont changé, le tout en
+ * une seule écriture. Plusieurs cellules sont regroupées par caractère :
+ * - DEMI_BLOCS : demi-bloc supérieur (U+2580) avec couleurs de premier plan et de fond, 1 x 2 cellules ;
+ * - BRAILLE : motif braille, 2 x 4 cellules (rouge s'il contient un obstacle) ;
+ * - AUTO : demi-blocs si la grille tient dans le terminal, braille sinon.
+ * Les couleurs sont celles de l'interface graphique (vivante en blanc,
+ * obstacle en rouge, vide en noir). Une grille plus grande que le terminal
+ * est affichée à travers une fenêtre que l'on fait défiler.
+ */
+class TerminalRenderer {
+public:
+    enum Mode {
+        AUTO,
+        DEMI_BLOCS,
+        BRAILLE
+    };
+
+    /**
+     * @brief Prépare l'affichage (taille du terminal détectée si width ou height vaut 0).
+     *
+     * @param mode Regroupement des cellules.
+     * @param width Largeur du terminal en caractères.
+     * @param height Hauteur du terminal en lignes (la dernière sert de ligne d'état).
+     */
+    explicit TerminalRenderer(Mode mode = AUTO, int width = 0, int height = 0);
+
+    /**
+     * @brief Restaure les couleurs et le curseur du terminal.
+     */
+    ~TerminalRenderer();
+
+    TerminalRenderer(const TerminalRenderer&) = delete;
+    TerminalRenderer& operator=(const TerminalRenderer&) = delete;
+
+    /**
+     * @brief Affiche une génération (seuls les caractères modifiés sont écrits).
+     */
+    void render(const GridSnapshot& snapshot, long long generation);
+
+    /**
+     * @brief Construit le texte d'une image sans l'écrire (utilisé par render()).
+     */
+    std::string frame(const GridSnapshot& snapshot, long long generation);
+
+    /**
+     * @brief Fait défiler la fenêtre d'affichage.
+     *
+     * @param rows Déplacement vertical en cellules.
+     * @param cols Déplacement horizontal en cellules.
+     */
+    void scroll(long long rows, long long cols);
+
+    /**
+     * @brief Rend la main au terminal : couleurs par défaut, curseur visible sous la grille.
+     *
+     * Le prochain appel à render() redessine tout l'écran.
+     */
+    void finish();
+
+    /**
+     * @brief Vérifie si la sortie standard est un terminal.
+     */
+    static bool isTerminal();
+
+    // Getters
+    int getViewRows() const { return glyphRows * cellHeight; }
+    int getViewCols() const { return glyphCols * cellWidth; }
+
+private:
+    /**
+     * @brief Caractère affiché : point de code et couleurs.
+     */
+    struct Glyph {
+        std::uint32_t codepoint;
+        unsigned char foreground;
+        unsigned char background;
+
+        bool operator==(const Glyph& other) const {
+            return codepoint == other.codepoint && foreground == other.foreground && background == other.background;
+        }
+        bool operator!=(const Glyph& other) const { return !(*this == other); }
+    };
+
+    Mode requestedMode;
+    Mode mode;
+    int width;
+    int height;
+    int glyphRows; // Lignes de la fenêtre (hors ligne d'état)
+    int glyphCols;
+    int cellWidth; // Cellules par caractère
+    int cellHeight;
+    long long top; // Première cellule affichée
+    long long left;
+    int gridRows; // Dimensions de la dernière grille affichée
+    int gridCols;
+    bool active; // Écran préparé (effacé, curseur masqué)
+    std::vector<Glyph> previous;
+    std::string status;
+
+    void layout(int rows, int cols);
+    Glyph glyphAt(const GridSnapshot& snapshot, long long row, long long col) const;
+};
+
+/**
+ * @brief Lecture non bloquante du clavier pendant l'affichage en terminal.
+ *
+ * Passe le terminal en mode brut (sans écho, sans attente de la touche
+ * Entrée) et le restaure à la destruction.
+ */
+class TerminalInput {
+public:
+    enum Key {
+        AUCUNE = -1,
+        HAUT = 1000,
+        BAS,
+        GAUCHE,
+        DROITE
+    };
+
+    TerminalInput();
+    ~TerminalInput();
+
+    TerminalInput(const TerminalInput&) = delete;
+    TerminalInput& operator=(const TerminalInput&) = delete;
+
+    /**
+     * @brief Retourne la touche appuyée (caractère ou flèche), AUCUNE sinon.
+     */
+    int poll();
+
+private:
+    bool raw;
+    std::vector<unsigned char> saved; // État du terminal à restaurer
+};
+
+#endif // TERMINALRENDERER_H
@@ -0,0 +1,134 @@
+// components/TextGridReader.cpp
+#include "TextGridReader.h"
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+const size_t MIN_CHUNK = 1 << 20; // Taille minimale d'un bloc analysé par un thread
+
+// Table des blancs (équivalente à isspace dans la locale « C »)
+struct SpaceTable {
+    bool space[256];
+    SpaceTable() {
+        fill(space, space + 256, false);
+        space[static_cast<unsigned char>(' ')] = true;
+        space[static_cast<unsigned char>('\t')] = true;
+        space[static_cast<unsigned char>('\n')] = true;
+        space[static_cast<unsigned char>('\v')] = true;
+        space[static_cast<unsigned char>('\f')] = true;
+        space[static_cast<unsigned char>('\r')] = true;
+    }
+};
+
+const SpaceTable spaces;
+
+inline bool isSpace(char c) {
+    return spaces.space[static_cast<unsigned char>(c)];
+}
+
+// Compte les jetons de [begin, end)
+size_t countTokens(const char* begin, const char* end) {
+    size_t tokens = 0;
+    bool inToken = false;
+    for (const char* p = begin; p < end; ++p) {
+        bool space = isSpace(*p);
+        tokens += !space && !inToken;
+        inToken = !space;
+    }
+    return tokens;
+}
+
+// Écrit les jetons de [begin, end) dans cells[first, limit)
+void parseTokens(const char* begin, const char* end, CellState* cells, size_t first, size_t limit) {
+    size_t index = first;
+    const char* p = begin;
+    while (p < end && index < limit) {
+        while (p < end && isSpace(*p)) ++p;
+        if (p == end) break;
+        const char* token = p;
+        while (p < end && !isSpace(*p)) ++p;
+        CellState state = VIDE;
+        if (p - token == 1) {
+            if (*token == '1') state = VIVANT;
+            else if (*token == 'X' || *token == 'x') state = OBSTACLE;
+        }
+        cells[index++] = state;
+    }
+}
+
+} // namespace
+
+TextGridReader::TextGridReader(const string& filename) {
+    file.open(filename);
+}
+
+// Déduit les dimensions de la grille à partir du fichier
+void TextGridReader::dimensions(int& rows, int& cols) const {
+    rows = 0;
+    cols = 0;
+    const char* p = file.data();
+    const char* end = p + file.size();
+    while (p < end) {
+        const char* lineEnd = find(p, end, '\n');
+        const char* first = p;
+        while (first < lineEnd && isSpace(*first)) ++first;
+        if (first < lineEnd) {
+            if (*first == '-') break; // Séparateur entre deux états
+            if (rows == 0) {
+                cols = static_cast<int>(countTokens(first, lineEnd));
+            }
+            rows++;
+        }
+        p = lineEnd < end ? lineEnd + 1 : end;
+    }
+}
+
+// Lit les count premiers jetons du fichier dans cells
+void TextGridReader::read(CellState* cells, size_t count, unsigned threads) const {
+    fill(cells, cells + count, VIDE); // Cellules sans jeton
+    const char* data = file.data();
+    size_t size = file.size();
+    if (size == 0 || count == 0) {
+        return;
+    }
+
+    if (threads == 0) {
+        threads = max(1u, thread::hardware_concurrency());
+    }
+    size_t chunks = min<size_t>(threads, max<size_t>(1, size / MIN_CHUNK));
+    if (chunks == 1) {
+        parseTokens(data, data + size, cells, 0, count);
+        return;
+    }
+
+    // Découper aux blancs pour qu'aucun jeton ne soit coupé entre deux blocs
+    vector<const char*> bounds(chunks + 1);
+    bounds[0] = data;
+    bounds[chunks] = data + size;
+    for (size_t c = 1; c < chunks; ++c) {
+        const char* p = max(bounds[c - 1], data + size * c / chunks);
+        while (p < data + size && !isSpace(*p)) ++p;
+        bounds[c] = p;
+    }
+
+    // Premier passage : nombre de jetons par bloc
+    vector<size_t> tokens(chunks);
+    vector<thread> workers;
+    for (size_t c = 0; c < chunks; ++c) {
+        workers.emplace_back([&, c] { tokens[c] = countTokens(bounds[c], bounds[c + 1]); });
+    }
+    for (thread& worker : workers) worker.join();
+    workers.clear();
+
+    // Second passage : chaque bloc écrit à partir de son premier indice
+    size_t first = 0;
+    for (size_t c = 0; c < chunks && first < count; ++c) {
+        workers.emplace_back(parseTokens, bounds[c], bounds[c + 1], cells, first, count);
+        first += tokens[c];
+    }
+    for (thread& worker : workers) worker.join();
+}
@@ -0,0 +1,55 @@
+// components/TextGridReader.h
+#ifndef TEXTGRIDREADER_H
+#define TEXTGRIDREADER_H
+
+#include "Cellule.h"
+#include "MappedFile.h"
+#include <string>
+#include <cstddef>
+
+/**
+ * @brief Lecteur rapide du format texte de la grille (« 1 », « X », « 0 »).
+ *
+ * Le fichier est projeté en mémoire puis découpé en blocs analysés en
+ * parallèle : un premier passage compte les jetons de chaque bloc, un second
+ * écrit directement les cellules à leur position finale. Le résultat est
+ * identique à une lecture jeton par jeton : « 1 » donne VIVANT, « X » ou
+ * « x » OBSTACLE, tout autre jeton VIDE, et les cellules sans jeton restent
+ * VIDE.
+ */
+class TextGridReader {
+public:
+    /**
+     * @brief Projette le fichier en mémoire.
+     *
+     * @param filename Nom du fichier.
+     * @throws std::runtime_error Si le fichier ne peut pas être ouvert.
+     */
+    explicit TextGridReader(const std::string& filename);
+
+    /**
+     * @brief Déduit les dimensions de la grille à partir du fichier.
+     *
+     * Le nombre de colonnes est le nombre de jetons de la première ligne non
+     * vide, le nombre de lignes celui des lignes non vides jusqu'à la fin du
+     * fichier ou jusqu'au premier séparateur « --- » (fichiers de sortie).
+     *
+     * @param rows Nombre de lignes déduit.
+     * @param cols Nombre de colonnes déduit.
+     */
+    void dimensions(int& rows, int& cols) const;
+
+    /**
+     * @brief Lit les count premiers jetons du fichier dans cells.
+     *
+     * @param cells Cellules de destination.
+     * @param count Nombre de cellules à remplir.
+     * @param threads Nombre de threads (0 : selon le matériel et la taille du fichier).
+     */
+    void read(CellState* cells, std::size_t count, unsigned threads = 0) const;
+
+private:
+    MappedFile file;
+};
+
+#endif // TEXTGRIDREADER_H
@@ -0,0 +1,129 @@
+// interfaces/TextureRenderer.cpp
+#include "TextureRenderer.h"
+#include "Palette.h"
+#include "Trace.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+TextureRenderer::TextureRenderer() : level(-1), firstRow(0), firstCol(0), width(0), height(0) {}
+
+// Recalcule les lignes [firstY, lastY) du tampon et les envoie à la carte graphique
+void TextureRenderer::redraw(int firstY, int lastY) {
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    const GridSnapshot& snapshot = mipmap.getSnapshot();
+    int rows = snapshot.getRows();
+    int cols = snapshot.getCols();
+    int side = 1 << level;
+    firstY = max(firstY, 0);
+    lastY = min(lastY, height);
+    if (firstY >= lastY || width == 0) {
+        return;
+    }
+
+    for (int y = firstY; y < lastY; ++y) {
+        sf::Uint8* pixel = &pixels[static_cast<size_t>(y) * width * 4];
+        int row = firstRow + y;
+        for (int x = 0; x < width; ++x, pixel += 4) {
+            int col = firstCol + x;
+            unsigned alive;
+            unsigned obstacles;
+            unsigned count;
+            unsigned long long counterSum;
+            if (level == 0) {
+                int offset = (row % tileSize) * tileSize + col % tileSize;
+                unsigned char state = snapshot.getTile(row / tileSize, col / tileSize)->cells[offset];
+                alive = state == VIVANT;
+                obstacles = state == OBSTACLE;
+                count = 1;
+                counterSum = snapshot.getCounterTile(row / tileSize, col / tileSize)->cells[offset];
+            }
+            else {
+                alive = mipmap.alive(level, row, col);
+                obstacles = mipmap.obstacles(level, row, col);
+                count = static_cast<unsigned>((min(rows, (row + 1) * side) - row * side) * (min(cols, (col + 1) * side) - col * side));
+                counterSum = mipmap.counterSum(level, row, col);
+            }
+            // Couleur moyenne du bloc, selon l'état ou les compteurs calculés par la grille
+            Palette::blockColor(snapshot.getCounters(), count, alive, obstacles, counterSum, pixel);
+            pixel[3] = 255;
+        }
+    }
+    texture.update(&pixels[static_cast<size_t>(firstY) * width * 4], static_cast<unsigned>(width),
+                   static_cast<unsigned>(lastY - firstY), 0, static_cast<unsigned>(firstY));
+}
+
+// Met à jour la pyramide, puis les pixels visibles qui ont changé
+void TextureRenderer::update(const GridSnapshot& snapshot, const Camera& camera) {
+    TRACE_SPAN("TextureRenderer::update");
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    mipmap.update(snapshot);
+    int rows = snapshot.getRows();
+    int cols = snapshot.getCols();
+
+    // Niveau le plus fin ne dépassant pas un bloc par pixel de l'écran
+    double cellsPerPixel = 1 / camera.getCellSize();
+    int newLevel = 0;
+    while (newLevel < DensityMipmap::LEVELS && (1 << newLevel) < cellsPerPixel) {
+        ++newLevel;
+    }
+    int side = 1 << newLevel;
+    int levelRows = newLevel == 0 ? rows : mipmap.getLevelRows(newLevel);
+    int levelCols = newLevel == 0 ? cols : mipmap.getLevelCols(newLevel);
+
+    // Blocs visibles (les autres ne sont jamais lus)
+    double viewRows = camera.getHeight() / camera.getCellSize();
+    double viewCols = camera.getWidth() / camera.getCellSize();
+    int top = static_cast<int>(max(0.0, min<double>(levelRows, floor(camera.getTop() / side))));
+    int bottom = static_cast<int>(max(0.0, min<double>(levelRows, ceil((camera.getTop() + viewRows) / side))));
+    int left = static_cast<int>(max(0.0, min<double>(levelCols, floor(camera.getLeft() / side))));
+    int right = static_cast<int>(max(0.0, min<double>(levelCols, ceil((camera.getLeft() + viewCols) / side))));
+
+    float scale = static_cast<float>(side * camera.getCellSize());
+    sprite.setPosition(static_cast<float>((left * side - camera.getLeft()) * camera.getCellSize()),
+                       static_cast<float>((top * side - camera.getTop()) * camera.getCellSize()));
+    sprite.setScale(scale, scale);
+
+    if (newLevel != level || top != firstRow || left != firstCol || bottom - top != height || right - left != width) {
+        // Vue déplacée : toute la partie visible est recalculée
+        level = newLevel;
+        firstRow = top;
+        firstCol = left;
+        height = bottom - top;
+        width = right - left;
+        pixels.resize(static_cast<size_t>(width) * height * 4);
+        sf::Vector2u size = texture.getSize();
+        if (static_cast<unsigned>(width) > size.x || static_cast<unsigned>(height) > size.y) {
+            texture.create(max(size.x, static_cast<unsigned>(width)), max(size.y, static_cast<unsigned>(height)));
+            sprite.setTexture(texture);
+        }
+        sprite.setTextureRect(sf::IntRect(0, 0, width, height));
+        redraw(0, height);
+        return;
+    }
+
+    // Vue inchangée : lignes couvrant des tuiles modifiées, regroupées quand elles sont contiguës
+    int dirtyFirst = 0;
+    int dirtyLast = 0;
+    for (int tile : mipmap.getChangedTiles()) {
+        int tr = tile / snapshot.getTileCols();
+        int first = tr * tileSize / side - firstRow;
+        int last = ((tr + 1) * tileSize + side - 1) / side - firstRow;
+        if (last <= 0 || first >= height) {
+            continue; // Tuile hors de la vue
+        }
+        if (first > dirtyLast) {
+            redraw(dirtyFirst, dirtyLast);
+            dirtyFirst = first;
+        }
+        dirtyLast = max(dirtyLast, last);
+    }
+    redraw(dirtyFirst, dirtyLast);
+}
+
+void TextureRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    if (width > 0 && height > 0) {
+        target.draw(sprite, states);
+    }
+}
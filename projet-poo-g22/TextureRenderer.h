@@ -0,0 +1,56 @@
+// interfaces/TextureRenderer.h
+#ifndef TEXTURERENDERER_H
+#define TEXTURERENDERER_H
+
+#include "Snapshot.h"
+#include "DensityMipmap.h"
+#include "Camera.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+/**
+ * @brief Dessin des très grandes grilles sous forme de texture.
+ *
+ * Seule la partie visible de la grille est écrite dans un tampon de
+ * pixels, puis affichée en un seul sprite mis à l'échelle. Vue de près,
+ * chaque pixel du tampon est une cellule ; vue de loin, c'est un bloc de
+ * la pyramide de densité (DensityMipmap), choisi pour ne pas dépasser un
+ * bloc par pixel de l'écran, colorié selon la proportion de cellules
+ * vivantes et d'obstacles, comme pour l'export d'images, ou selon les
+ * compteurs d'âge ou d'activité de l'instantané (Palette).
+ *
+ * Tant que la caméra ne bouge pas, seules les lignes du tampon couvrant
+ * des tuiles modifiées depuis l'instantané précédent sont recalculées et
+ * envoyées à la carte graphique.
+ */
+class TextureRenderer : public sf::Drawable {
+public:
+    /**
+     * @brief Construit un affichage vide.
+     */
+    TextureRenderer();
+
+    /**
+     * @brief Met à jour la texture à partir d'un instantané et de la caméra.
+     */
+    void update(const GridSnapshot& snapshot, const Camera& camera);
+
+    // Getters
+    int getLevel() const { return level; }
+
+private:
+    DensityMipmap mipmap;
+    int level; // 0 : une cellule par pixel du tampon ; k : blocs de 2^k x 2^k cellules
+    int firstRow; // Premier bloc visible
+    int firstCol;
+    int width; // Blocs visibles (dimensions utiles du tampon)
+    int height;
+    std::vector<sf::Uint8> pixels; // R, V, B, alpha ligne par ligne
+    sf::Texture texture;
+    sf::Sprite sprite;
+
+    void redraw(int firstY, int lastY);
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+};
+
+#endif // TEXTURERENDERER_H
@@ -0,0 +1,165 @@
+// services/Trace.cpp
+#include "Trace.h"
+#include <mutex>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+atomic<bool> Trace::active(false);
+
+namespace {
+
+const size_t FLUSH_SIZE = 1 << 20; // Taille des blocs écrits sur le disque
+const int EVENT_SIZE = 256; // Longueur maximale d'un événement
+const size_t NAME_SIZE = 128; // Longueur maximale d'un nom échappé : un événement tient toujours dans EVENT_SIZE
+const chrono::steady_clock::time_point ORIGIN = chrono::steady_clock::now(); // Zéro de l'horloge de la trace
+
+// Copie un nom dans une chaîne JSON : « " » et « \ » sont échappés, les caractères de contrôle ignorés ;
+// un nom trop long est tronqué sans couper une séquence d'échappement ni un caractère UTF-8
+void escapeName(const char* name, char* out) {
+    size_t n = 0;
+    for (; *name; ++name) {
+        unsigned char c = static_cast<unsigned char>(*name);
+        if (c < 0x20) continue;
+        bool escaped = c == '"' || c == '\\';
+        // Place réservée pour tout le caractère à son premier octet : les octets de suite tiennent toujours
+        size_t width = escaped ? 2 : c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+        if ((c & 0xC0) != 0x80 && n + width >= NAME_SIZE) {
+            break;
+        }
+        if (escaped) out[n++] = '\\';
+        out[n++] = static_cast<char>(c);
+    }
+    out[n] = '\0';
+}
+
+/**
+ * @brief Fichier de trace en cours et noms des threads.
+ */
+struct TraceFile {
+    mutex fileMutex;
+    FILE* file;
+    string buffer;
+    bool first; // Aucun événement écrit depuis l'ouverture
+    bool failed;
+    vector<pair<int, const char*>> threadNames;
+
+    TraceFile() : file(nullptr), first(true), failed(false) {}
+
+    // Une trace encore ouverte à la fin du programme est terminée proprement
+    ~TraceFile() {
+        lock_guard<mutex> lock(fileMutex);
+        close();
+    }
+
+    void flush() {
+        if (!buffer.empty()) {
+            failed = fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size() || failed;
+            buffer.clear();
+        }
+    }
+
+    bool close() {
+        if (!file) {
+            return true;
+        }
+        buffer += "\n],\"displayTimeUnit\":\"ms\"}\n";
+        flush();
+        bool success = fclose(file) == 0 && !failed;
+        file = nullptr;
+        return success;
+    }
+
+    void appendEvent(const char* event, int length) {
+        if (!first) {
+            buffer += ",\n";
+        }
+        buffer.append(event, static_cast<size_t>(min(length, EVENT_SIZE - 1)));
+        first = false;
+    }
+
+    void appendThreadName(int thread, const char* name) {
+        char escaped[NAME_SIZE];
+        escapeName(name, escaped);
+        char event[EVENT_SIZE];
+        int length = snprintf(event, sizeof(event), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", thread, escaped);
+        appendEvent(event, length);
+    }
+};
+
+TraceFile& traceFile() {
+    static TraceFile instance;
+    return instance;
+}
+
+// Identifiant du thread appelant dans la trace (attribué au premier événement)
+int threadId() {
+    static atomic<int> next(1);
+    thread_local int id = next.fetch_add(1, memory_order_relaxed);
+    return id;
+}
+
+} // namespace
+
+// Démarre l'enregistrement dans un fichier
+void Trace::start(const string& filename) {
+    stop();
+    TraceFile& trace = traceFile();
+    lock_guard<mutex> lock(trace.fileMutex);
+    trace.file = fopen(filename.c_str(), "wb");
+    if (!trace.file) {
+        throw runtime_error("Impossible de créer le fichier de trace : " + filename);
+    }
+    trace.buffer = "{\"traceEvents\":[\n";
+    trace.first = true;
+    trace.failed = false;
+    for (const pair<int, const char*>& thread : trace.threadNames) {
+        trace.appendThreadName(thread.first, thread.second);
+    }
+    active.store(true, memory_order_relaxed);
+}
+
+// Termine l'enregistrement et ferme le fichier
+bool Trace::stop() {
+    active.store(false, memory_order_relaxed);
+    TraceFile& trace = traceFile();
+    lock_guard<mutex> lock(trace.fileMutex);
+    return trace.close();
+}
+
+// Nomme le thread appelant (le nom est repris par les traces démarrées ensuite)
+void Trace::setThreadName(const char* name) {
+    int thread = threadId();
+    TraceFile& trace = traceFile();
+    lock_guard<mutex> lock(trace.fileMutex);
+    trace.threadNames.emplace_back(thread, name);
+    if (trace.file) {
+        trace.appendThreadName(thread, name);
+    }
+}
+
+double Trace::now() {
+    return chrono::duration<double, micro>(chrono::steady_clock::now() - ORIGIN).count();
+}
+
+// Enregistre un événement complet (« X ») du thread appelant
+void Trace::complete(const char* name, double begin, double end) {
+    int thread = threadId();
+    TraceFile& trace = traceFile();
+    lock_guard<mutex> lock(trace.fileMutex);
+    if (!trace.file) {
+        return; // Trace arrêtée pendant la mesure
+    }
+    char escaped[NAME_SIZE];
+    escapeName(name, escaped);
+    char event[EVENT_SIZE];
+    int length = snprintf(event, sizeof(event), "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}", escaped, thread, begin, end - begin);
+    trace.appendEvent(event, length);
+    if (trace.buffer.size() >= FLUSH_SIZE) {
+        trace.flush();
+    }
+}
@@ -0,0 +1,108 @@
+// services/Trace.h
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <string>
+#include <atomic>
+
+/**
+ * @brief Compilation des points de trace : 0 les fait disparaître du binaire.
+ */
+#ifndef TRACE_COMPILED
+#define TRACE_COMPILED 1
+#endif
+
+/**
+ * @brief Trace chronologique au format JSON de Chrome (chrome://tracing, Perfetto).
+ *
+ * Les points de trace (TRACE_SPAN) mesurent la durée d'un bloc et
+ * l'enregistrent comme un événement complet, avec le thread qui l'a
+ * exécuté. Tant que la trace n'est pas démarrée, un point de trace ne coûte
+ * qu'un test prévisible d'un booléen : l'horloge n'est pas lue. Une fois
+ * démarrée, les événements sont mis en forme sous un verrou et écrits par
+ * blocs ; les points de trace sont placés autour d'opérations longues
+ * (génération, bande de lignes, image, écriture) et non par cellule.
+ *
+ * Utilisation : TRACE_SPAN("Grid::update");
+ */
+class Trace {
+public:
+    /**
+     * @brief Vérifie si la trace est démarrée.
+     */
+    static bool enabled() { return active.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Démarre l'enregistrement dans un fichier (une trace en cours est d'abord terminée).
+     *
+     * @param filename Nom du fichier JSON (écrasé s'il existe).
+     * @throws std::runtime_error Si le fichier ne peut pas être créé.
+     */
+    static void start(const std::string& filename);
+
+    /**
+     * @brief Termine l'enregistrement et ferme le fichier.
+     *
+     * @return true Si toutes les écritures ont réussi (ou si aucune trace n'était en cours).
+     * @return false Sinon.
+     */
+    static bool stop();
+
+    /**
+     * @brief Nomme le thread appelant dans la trace (chaîne littérale ASCII).
+     */
+    static void setThreadName(const char* name);
+
+    /**
+     * @brief Instant courant en microsecondes, sur l'horloge de la trace.
+     */
+    static double now();
+
+    /**
+     * @brief Enregistre un événement complet du thread appelant.
+     *
+     * @param name Nom de l'événement (chaîne littérale ASCII).
+     * @param begin Début en microsecondes (voir now).
+     * @param end Fin en microsecondes.
+     */
+    static void complete(const char* name, double begin, double end);
+
+    /**
+     * @brief Mesure la durée de vie de l'objet si la trace est démarrée.
+     */
+    class Span {
+    public:
+        explicit Span(const char* spanName) : name(Trace::enabled() ? spanName : nullptr), begin(0.0) {
+            if (name) {
+                begin = Trace::now();
+            }
+        }
+
+        ~Span() {
+            if (name) {
+                Trace::complete(name, begin, Trace::now());
+            }
+        }
+
+        Span(const Span&) = delete;
+        Span& operator=(const Span&) = delete;
+
+    private:
+        const char* name; // nullptr : trace arrêtée à la construction
+        double begin;
+    };
+
+private:
+    static std::atomic<bool> active;
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+
+#if TRACE_COMPILED
+#define TRACE_SPAN(name) Trace::Span TRACE_CONCAT(traceSpan, __LINE__)(name)
+#else
+#define TRACE_SPAN(name) do {} while (0)
+#endif
+
+#endif // TRACE_H
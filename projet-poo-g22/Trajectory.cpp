@@ -0,0 +1,338 @@
+// components/Trajectory.cpp
+#include "Trajectory.h"
+#include <stdexcept>
+#include <cstring>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+const char FILE_MAGIC[4] = { 'G', 'O', 'L', 'T' };
+const uint32_t FILE_VERSION = 1;
+const uint32_t RECORD_MAGIC = 0x44524352; // "RCRD"
+const int KEYFRAME = 0;
+const int DELTA = 1;
+
+// En-tête du fichier
+struct FileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t rows;
+    uint32_t cols;
+    uint32_t keyframeInterval;
+    uint32_t reserved;
+};
+
+// En-tête d'un enregistrement (une génération)
+struct RecordHeader {
+    uint32_t magic;
+    uint32_t type;
+    int64_t generation;
+    uint32_t payloadSize;
+    uint32_t checksum;
+};
+
+// Somme de contrôle FNV-1a sur 32 bits
+uint32_t checksum(const unsigned char* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+void putVarint(vector<unsigned char>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<unsigned char>(value));
+}
+
+uint64_t getVarint(const unsigned char*& in) {
+    uint64_t value = 0;
+    int shift = 0;
+    while (*in & 0x80) {
+        value |= static_cast<uint64_t>(*in++ & 0x7F) << shift;
+        shift += 7;
+    }
+    value |= static_cast<uint64_t>(*in++) << shift;
+    return value;
+}
+
+void truncateFile(FILE* file, uint64_t size) {
+    fflush(file);
+#ifdef _WIN32
+    _chsize_s(_fileno(file), static_cast<long long>(size));
+#else
+    if (ftruncate(fileno(file), static_cast<off_t>(size)) != 0) {
+        throw runtime_error("Impossible de tronquer le fichier de trajectoire.");
+    }
+#endif
+}
+
+// Force l'écriture sur le disque de ce qui a déjà été transmis au système
+bool syncFile(FILE* file) {
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+} // namespace
+
+// Crée un nouveau fichier de trajectoire
+Trajectory::Trajectory(const string& name, int r, int c, int interval)
+    : file(nullptr), filename(name), fileSize(0), rows(r), cols(c),
+      keyframeInterval(interval > 0 ? interval : 1), firstGeneration(0) {
+    file = fopen(filename.c_str(), "w+b");
+    if (!file) {
+        throw runtime_error("Impossible de créer le fichier de trajectoire.");
+    }
+    FileHeader header = {};
+    memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.version = FILE_VERSION;
+    header.rows = static_cast<uint32_t>(rows);
+    header.cols = static_cast<uint32_t>(cols);
+    header.keyframeInterval = static_cast<uint32_t>(keyframeInterval);
+    fwrite(&header, sizeof(header), 1, file);
+    fflush(file);
+    fileSize = sizeof(header);
+}
+
+// Rouvre un fichier de trajectoire existant
+Trajectory::Trajectory(const string& name)
+    : file(nullptr), filename(name), fileSize(0), rows(0), cols(0), keyframeInterval(1), firstGeneration(0) {
+    scanRecords();
+    file = fopen(filename.c_str(), "r+b");
+    if (!file) {
+        throw runtime_error("Impossible d'ouvrir le fichier de trajectoire.");
+    }
+    if (fileSize < mapping.size()) {
+        // Enregistrement incomplet après un arrêt brutal : reprendre à la dernière génération complète
+        mapping.close();
+        truncateFile(file, fileSize);
+    }
+    fseek(file, 0, SEEK_END);
+    // previous reste vide : la prochaine génération ajoutée sera une image clé
+}
+
+Trajectory::~Trajectory() {
+    if (file) {
+        fclose(file);
+    }
+}
+
+// Reconstruit l'index en parcourant les en-têtes des enregistrements
+void Trajectory::scanRecords() {
+    mapping.open(filename);
+    const char* data = mapping.data();
+    uint64_t size = mapping.size();
+
+    FileHeader header;
+    if (size < sizeof(header)) {
+        throw runtime_error("Fichier de trajectoire invalide.");
+    }
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 || header.version != FILE_VERSION) {
+        throw runtime_error("Fichier de trajectoire invalide.");
+    }
+    rows = static_cast<int>(header.rows);
+    cols = static_cast<int>(header.cols);
+    keyframeInterval = static_cast<int>(header.keyframeInterval);
+
+    uint64_t offset = sizeof(header);
+    while (offset + sizeof(RecordHeader) <= size) {
+        RecordHeader record;
+        memcpy(&record, data + offset, sizeof(record));
+        uint64_t end = offset + sizeof(record) + record.payloadSize;
+        if (record.magic != RECORD_MAGIC || end > size ||
+            checksum(reinterpret_cast<const unsigned char*>(data + offset + sizeof(record)), record.payloadSize) != record.checksum) {
+            break; // Enregistrement incomplet ou corrompu
+        }
+
+        long long generation = record.generation;
+        if (index.empty()) {
+            if (record.type != KEYFRAME) break;
+            firstGeneration = generation;
+        }
+        else if (generation < firstGeneration || generation > getLastGeneration() + 1 ||
+                 (record.type == DELTA && generation == firstGeneration)) {
+            break;
+        }
+        // Une génération réécrite abandonne les suivantes
+        index.resize(static_cast<size_t>(generation - firstGeneration));
+        IndexEntry entry;
+        entry.offset = offset;
+        entry.keyframe = record.type == KEYFRAME ? generation : index.back().keyframe;
+        index.push_back(entry);
+        offset = end;
+    }
+    fileSize = offset;
+}
+
+// Ajoute l'état d'une génération à la fin du fichier
+void Trajectory::append(long long generation, const GridSnapshot& snapshot) {
+    if (snapshot.getRows() != rows || snapshot.getCols() != cols) {
+        throw runtime_error("Dimensions de l'instantané incompatibles avec la trajectoire.");
+    }
+    bool consecutive = !index.empty() && generation == getLastGeneration() + 1 && previous.getRows() != 0;
+    if (!index.empty() && generation != getLastGeneration() + 1) {
+        // Réécriture après un retour en arrière ; une génération hors de la trajectoire (fichier chargé)
+        // la fait repartir de zéro. Les enregistrements abandonnés sont retirés du fichier.
+        size_t kept = contains(generation) ? static_cast<size_t>(generation - firstGeneration) : 0;
+        fileSize = index[kept].offset;
+        index.resize(kept);
+        mapping.close();
+        truncateFile(file, fileSize);
+    }
+    if (index.empty()) {
+        firstGeneration = generation;
+    }
+
+    bool keyframe = !consecutive || generation % keyframeInterval == 0;
+    if (keyframe) {
+        encodeKeyframe(snapshot);
+    }
+    else {
+        encodeDelta(snapshot);
+    }
+    writeRecord(keyframe ? KEYFRAME : DELTA, generation);
+
+    IndexEntry entry;
+    entry.offset = fileSize;
+    entry.keyframe = keyframe ? generation : index.back().keyframe;
+    index.push_back(entry);
+    fileSize += sizeof(RecordHeader) + buffer.size();
+    previous = snapshot; // Copie de la table des tuiles, partagées
+}
+
+// Image clé : 2 bits par cellule, ligne par ligne
+void Trajectory::encodeKeyframe(const GridSnapshot& snapshot) {
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    buffer.assign((static_cast<size_t>(rows) * cols + 3) / 4, 0);
+    size_t i = 0;
+    for (int r = 0; r < rows; ++r) {
+        for (int tc = 0; tc < snapshot.getTileCols(); ++tc) {
+            const GridSnapshot::TilePtr& tile = snapshot.getTile(r / tileSize, tc);
+            int width = min(tileSize, cols - tc * tileSize);
+            if (tile == GridSnapshot::emptyTile()) {
+                i += width; // Cellules VIDE : bits nuls
+                continue;
+            }
+            const unsigned char* cells = tile->cells + (r % tileSize) * tileSize;
+            for (int j = 0; j < width; ++j, ++i) {
+                buffer[i / 4] |= static_cast<unsigned char>((cells[j] & 3) << ((i % 4) * 2));
+            }
+        }
+    }
+}
+
+// Delta : écart avec la cellule modifiée précédente et nouvel état
+void Trajectory::encodeDelta(const GridSnapshot& snapshot) {
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    int tileCols = snapshot.getTileCols();
+    buffer.clear();
+    // Seules les tuiles qui ne sont plus partagées avec la génération précédente sont comparées ;
+    // les tuiles d'une même rangée sont parcourues ligne par ligne pour garder les positions croissantes
+    snapshot.changedTiles(previous, changedTiles);
+    size_t position = 0;
+    for (size_t first = 0; first < changedTiles.size();) {
+        int tr = changedTiles[first] / tileCols;
+        size_t end = first;
+        while (end < changedTiles.size() && changedTiles[end] / tileCols == tr) {
+            ++end;
+        }
+        int height = min(tileSize, rows - tr * tileSize);
+        for (int i = 0; i < height; ++i) {
+            size_t rowStart = static_cast<size_t>(tr * tileSize + i) * cols;
+            for (size_t k = first; k < end; ++k) {
+                int tc = changedTiles[k] % tileCols;
+                const unsigned char* now = snapshot.getTile(tr, tc)->cells + i * tileSize;
+                const unsigned char* old = previous.getTile(tr, tc)->cells + i * tileSize;
+                int width = min(tileSize, cols - tc * tileSize);
+                for (int j = 0; j < width; ++j) {
+                    if ((now[j] & 3) != (old[j] & 3)) {
+                        size_t cell = rowStart + tc * tileSize + j;
+                        putVarint(buffer, (static_cast<uint64_t>(cell - position) << 2) | (now[j] & 3));
+                        position = cell;
+                    }
+                }
+            }
+        }
+        first = end;
+    }
+}
+
+// Écrit l'enregistrement contenu dans buffer
+void Trajectory::writeRecord(int type, long long generation) {
+    RecordHeader record;
+    record.magic = RECORD_MAGIC;
+    record.type = static_cast<uint32_t>(type);
+    record.generation = generation;
+    record.payloadSize = static_cast<uint32_t>(buffer.size());
+    record.checksum = checksum(buffer.data(), buffer.size());
+    fseek(file, 0, SEEK_END);
+    if (fwrite(&record, sizeof(record), 1, file) != 1 ||
+        (!buffer.empty() && fwrite(buffer.data(), buffer.size(), 1, file) != 1) ||
+        fflush(file) != 0 || (type == KEYFRAME && !syncFile(file))) {
+        throw runtime_error("Erreur d'écriture dans le fichier de trajectoire.");
+    }
+}
+
+// Vérifie si une génération est présente dans le fichier
+bool Trajectory::contains(long long generation) const {
+    return !index.empty() && generation >= firstGeneration && generation <= getLastGeneration();
+}
+
+// Retourne le début de l'enregistrement d'une génération dans la projection
+const char* Trajectory::record(long long generation) {
+    const IndexEntry& entry = index[static_cast<size_t>(generation - firstGeneration)];
+    if (mapping.size() < fileSize) {
+        mapping.open(filename); // Le fichier a grandi depuis la dernière projection
+    }
+    return mapping.data() + entry.offset;
+}
+
+// Relit l'état d'une génération
+bool Trajectory::read(long long generation, vector<CellState>& cells) {
+    if (!contains(generation)) {
+        return false;
+    }
+    cells.resize(static_cast<size_t>(rows) * cols);
+    long long keyframe = index[static_cast<size_t>(generation - firstGeneration)].keyframe;
+    decodeKeyframe(record(keyframe) + sizeof(RecordHeader), cells);
+    for (long long g = keyframe + 1; g <= generation; ++g) {
+        const char* data = record(g);
+        RecordHeader header;
+        memcpy(&header, data, sizeof(header));
+        applyDelta(data + sizeof(header), header.payloadSize, cells);
+    }
+    return true;
+}
+
+void Trajectory::decodeKeyframe(const char* payload, vector<CellState>& cells) const {
+    const unsigned char* in = reinterpret_cast<const unsigned char*>(payload);
+    for (size_t i = 0; i < cells.size(); ++i) {
+        cells[i] = static_cast<CellState>((in[i / 4] >> ((i % 4) * 2)) & 3);
+    }
+}
+
+void Trajectory::applyDelta(const char* payload, uint32_t size, vector<CellState>& cells) const {
+    const unsigned char* in = reinterpret_cast<const unsigned char*>(payload);
+    const unsigned char* end = in + size;
+    size_t position = 0;
+    while (in < end) {
+        uint64_t value = getVarint(in);
+        position += static_cast<size_t>(value >> 2);
+        cells[position] = static_cast<CellState>(value & 3);
+    }
+}
@@ -0,0 +1,124 @@
+// components/Trajectory.h
+#ifndef TRAJECTORY_H
+#define TRAJECTORY_H
+
+#include "Cellule.h"
+#include "MappedFile.h"
+#include "Snapshot.h"
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+
+/**
+ * @brief Fichier de trajectoire en ajout seul (images clés + deltas).
+ *
+ * Chaque génération est un enregistrement : soit une image clé (toutes les
+ * cellules sur 2 bits), soit la liste des cellules modifiées depuis la
+ * génération précédente. Une image clé est écrite toutes les
+ * keyframeInterval générations, si bien que relire n'importe quelle
+ * génération coûte au plus une image clé et keyframeInterval - 1 deltas.
+ * Un delta ne compare que les tuiles modifiées depuis l'instantané
+ * précédent (voir GridSnapshot::changedTiles).
+ *
+ * La lecture se fait par projection en mémoire du fichier. Chaque
+ * enregistrement porte une somme de contrôle : à la réouverture, un
+ * enregistrement incomplet (arrêt brutal) est tronqué et la trajectoire
+ * reprend à la dernière génération complète. Les images clés sont
+ * forcées sur le disque (fsync) : un arrêt du système ne perd au plus que
+ * les deltas écrits depuis la dernière image clé.
+ */
+class Trajectory {
+public:
+    /**
+     * @brief Crée un nouveau fichier de trajectoire (écrase le fichier existant).
+     *
+     * @param filename Nom du fichier.
+     * @param rows Nombre de lignes de la grille.
+     * @param cols Nombre de colonnes de la grille.
+     * @param keyframeInterval Nombre de générations entre deux images clés.
+     * @throws std::runtime_error Si le fichier ne peut pas être créé.
+     */
+    Trajectory(const std::string& filename, int rows, int cols, int keyframeInterval);
+
+    /**
+     * @brief Rouvre un fichier de trajectoire existant pour le relire et le prolonger.
+     *
+     * @param filename Nom du fichier.
+     * @throws std::runtime_error Si le fichier est absent ou invalide.
+     */
+    explicit Trajectory(const std::string& filename);
+
+    ~Trajectory();
+
+    Trajectory(const Trajectory&) = delete;
+    Trajectory& operator=(const Trajectory&) = delete;
+
+    /**
+     * @brief Ajoute l'état d'une génération à la fin du fichier.
+     *
+     * Si la génération n'est pas la suivante de la dernière ajoutée (après
+     * un retour en arrière), les générations suivantes sont abandonnées, le
+     * fichier est tronqué à leur début et une image clé est écrite. Une
+     * génération hors de la trajectoire (fichier chargé) la fait repartir
+     * de cette génération.
+     *
+     * @param generation Numéro de la génération.
+     * @param snapshot Instantané de la grille à cette génération.
+     * @throws std::runtime_error Si l'écriture échoue.
+     */
+    void append(long long generation, const GridSnapshot& snapshot);
+
+    /**
+     * @brief Relit l'état d'une génération.
+     *
+     * @param generation Numéro de la génération.
+     * @param cells Cellules de destination, redimensionnées si nécessaire.
+     * @return true Si la génération est présente dans le fichier.
+     * @return false Sinon.
+     */
+    bool read(long long generation, std::vector<CellState>& cells);
+
+    /**
+     * @brief Vérifie si une génération est présente dans le fichier.
+     */
+    bool contains(long long generation) const;
+
+    // Getters
+    int getRows() const { return rows; }
+    int getCols() const { return cols; }
+    long long getFirstGeneration() const { return firstGeneration; }
+    long long getLastGeneration() const { return firstGeneration + static_cast<long long>(index.size()) - 1; }
+
+private:
+    /**
+     * @brief Entrée de l'index : position d'un enregistrement et de son image clé.
+     */
+    struct IndexEntry {
+        std::uint64_t offset;
+        long long keyframe;
+    };
+
+    std::FILE* file;
+    std::string filename;
+    MappedFile mapping;
+    std::uint64_t fileSize; // Octets écrits et complets
+    int rows;
+    int cols;
+    int keyframeInterval;
+    long long firstGeneration;
+    std::vector<IndexEntry> index; // Une entrée par génération, depuis firstGeneration
+    GridSnapshot previous; // Dernière génération ajoutée (0 x 0 : image clé à la prochaine génération)
+    std::vector<int> changedTiles; // Tuiles modifiées depuis previous
+    std::vector<unsigned char> buffer; // Contenu de l'enregistrement en cours d'écriture
+
+    void encodeKeyframe(const GridSnapshot& snapshot);
+    void encodeDelta(const GridSnapshot& snapshot);
+    void writeRecord(int type, long long generation);
+    void scanRecords();
+    const char* record(long long generation);
+    void decodeKeyframe(const char* payload, std::vector<CellState>& cells) const;
+    void applyDelta(const char* payload, std::uint32_t size, std::vector<CellState>& cells) const;
+};
+
+#endif // TRAJECTORY_H
@@ -0,0 +1,65 @@
+// components/TripleBuffer.h
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+#include <atomic>
+
+/**
+ * @brief Échange sans verrou de la dernière valeur complète entre deux threads.
+ *
+ * L'écrivain remplit back() puis appelle publish() ; le lecteur appelle
+ * update() puis lit front(). Trois emplacements suffisent pour que ni l'un
+ * ni l'autre n'attende jamais : l'écrivain échange son emplacement avec
+ * l'emplacement intermédiaire, le lecteur récupère ce dernier s'il a été
+ * publié depuis sa dernière lecture. Les valeurs intermédiaires que le
+ * lecteur n'a pas eu le temps de lire sont remplacées.
+ */
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() : backIndex(0), frontIndex(2), middle(1) {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /**
+     * @brief Emplacement en cours d'écriture (écrivain uniquement).
+     */
+    T& back() { return slots[backIndex]; }
+
+    /**
+     * @brief Publie back() ; l'écrivain reçoit un autre emplacement.
+     */
+    void publish() {
+        backIndex = middle.exchange(backIndex | FRESH, std::memory_order_acq_rel) & INDEX;
+    }
+
+    /**
+     * @brief Récupère la dernière valeur publiée, s'il y en a une nouvelle (lecteur uniquement).
+     *
+     * @return true Si front() a changé.
+     */
+    bool update() {
+        if (!(middle.load(std::memory_order_acquire) & FRESH)) {
+            return false;
+        }
+        frontIndex = middle.exchange(frontIndex, std::memory_order_acq_rel) & INDEX;
+        return true;
+    }
+
+    /**
+     * @brief Dernière valeur récupérée par update() (lecteur uniquement).
+     */
+    const T& front() const { return slots[frontIndex]; }
+
+private:
+    static const int INDEX = 3;
+    static const int FRESH = 4; // Emplacement intermédiaire publié et pas encore lu
+
+    T slots[3];
+    int backIndex; // Propriété de l'écrivain
+    int frontIndex; // Propriété du lecteur
+    std::atomic<int> middle; // Indice de l'emplacement intermédiaire (et indicateur FRESH)
+};
+
+#endif // TRIPLEBUFFER_H
@@ -0,0 +1,85 @@
+// components/WorkerPool.cpp
+#include "WorkerPool.h"
+#include "Trace.h"
+#include <algorithm>
+
+using namespace std;
+
+// Démarre les threads
+WorkerPool::WorkerPool(unsigned threads, size_t maxPending) : active(0), stopping(false) {
+    if (threads == 0) {
+        threads = max(1u, thread::hardware_concurrency());
+    }
+    capacity = maxPending > 0 ? maxPending : 2 * static_cast<size_t>(threads);
+    for (unsigned i = 0; i < threads; ++i) {
+        workers.emplace_back(&WorkerPool::run, this);
+    }
+}
+
+// Termine les tâches en attente et arrête les threads
+WorkerPool::~WorkerPool() {
+    {
+        lock_guard<mutex> lock(queueMutex);
+        stopping = true;
+    }
+    taskAvailable.notify_all();
+    for (thread& worker : workers) {
+        worker.join();
+    }
+}
+
+// Ajoute une tâche (bloque si la file est pleine)
+void WorkerPool::submit(function<void()> task) {
+    unique_lock<mutex> lock(queueMutex);
+    slotAvailable.wait(lock, [this] { return tasks.size() < capacity; });
+    tasks.push_back(move(task));
+    taskAvailable.notify_one();
+}
+
+// Attend la fin de toutes les tâches soumises
+void WorkerPool::wait() {
+    TRACE_SPAN("WorkerPool::wait");
+    unique_lock<mutex> lock(queueMutex);
+    idle.wait(lock, [this] { return tasks.empty() && active == 0; });
+    if (error) {
+        exception_ptr failure = error;
+        error = nullptr;
+        rethrow_exception(failure);
+    }
+}
+
+// Boucle d'un thread : exécute les tâches jusqu'à l'arrêt
+void WorkerPool::run() {
+    Trace::setThreadName("WorkerPool");
+    for (;;) {
+        function<void()> task;
+        {
+            unique_lock<mutex> lock(queueMutex);
+            taskAvailable.wait(lock, [this] { return !tasks.empty() || stopping; });
+            if (tasks.empty()) {
+                return; // Arrêt demandé et file vide
+            }
+            task = move(tasks.front());
+            tasks.pop_front();
+            ++active;
+        }
+        slotAvailable.notify_one();
+
+        exception_ptr failure;
+        try {
+            TRACE_SPAN("WorkerPool::task");
+            task();
+        }
+        catch (...) {
+            failure = current_exception();
+        }
+
+        lock_guard<mutex> lock(queueMutex);
+        if (failure && !error) {
+            error = failure;
+        }
+        if (--active == 0 && tasks.empty()) {
+            idle.notify_all();
+        }
+    }
+}
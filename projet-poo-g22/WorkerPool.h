@@ -0,0 +1,70 @@
+// components/WorkerPool.h
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <cstddef>
+
+/**
+ * @brief Groupe de threads exécutant des tâches en arrière-plan.
+ *
+ * Les tâches sont placées dans une file bornée : submit() attend qu'une
+ * place se libère, ce qui évite d'accumuler du travail en mémoire quand
+ * les threads ne suivent pas. La première exception levée par une tâche
+ * est relancée par wait().
+ */
+class WorkerPool {
+public:
+    /**
+     * @brief Démarre les threads.
+     *
+     * @param threads Nombre de threads (0 : selon le matériel).
+     * @param capacity Nombre maximal de tâches en attente (0 : deux par thread).
+     */
+    explicit WorkerPool(unsigned threads = 0, std::size_t capacity = 0);
+
+    /**
+     * @brief Termine les tâches en attente et arrête les threads.
+     */
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * @brief Ajoute une tâche (bloque si la file est pleine).
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * @brief Attend la fin de toutes les tâches soumises.
+     *
+     * @throws L'exception levée par une tâche, le cas échéant.
+     */
+    void wait();
+
+    // Getters
+    unsigned getThreadCount() const { return static_cast<unsigned>(workers.size()); }
+
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::size_t capacity;
+    std::size_t active; // Tâches en cours d'exécution
+    bool stopping;
+    std::exception_ptr error;
+    std::mutex queueMutex;
+    std::condition_variable taskAvailable;
+    std::condition_variable slotAvailable;
+    std::condition_variable idle;
+
+    void run();
+};
+
+#endif // WORKERPOOL_H
@@ -1,8 +1,15 @@
 // main.cpp
 #include "Game.h"
 
-int main() {
+int main(int argc, char* argv[]) {
     Game game;
+#ifdef JEU_DE_LA_VIE_HEADLESS
+    return game.runHeadless(argc, argv); // Construction sans SFML : uniquement le mode sans affichage
+#else
+    if (argc > 1) {
+        return game.runHeadless(argc, argv); // Mode sans affichage (traitements par lots)
+    }
     game.run();
     return 0;
+#endif
 }
@@ -0,0 +1,159 @@
+// regression/Corpus.cpp
+#include "Corpus.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <random>
+#include <cstdio>
+
+using namespace std;
+
+namespace {
+
+const char SOUP_PREFIX[] = "soupe:";
+
+bool hasExtension(const string& filename, const string& extension) {
+    return filename.size() > extension.size() &&
+           filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+runtime_error corpusError(const string& filename, int line, const string& message) {
+    return runtime_error(filename + ":" + to_string(line) + " : " + message);
+}
+
+// Soupe aléatoire : « soupe:<vivantes %>:<graine>[:<obstacles %>] »
+Pattern soup(const CorpusEntry& entry) {
+    int alivePercent = 0;
+    unsigned seed = 0;
+    int obstaclePercent = 0;
+    int fields = sscanf(entry.source.c_str() + sizeof(SOUP_PREFIX) - 1, "%d:%u:%d", &alivePercent, &seed, &obstaclePercent);
+    if (fields < 2 || alivePercent < 0 || obstaclePercent < 0 || alivePercent + obstaclePercent > 100) {
+        throw runtime_error("Soupe invalide : " + entry.source);
+    }
+    Pattern pattern;
+    pattern.alive = BitPlane(entry.rows, entry.cols);
+    pattern.obstacles = BitPlane(entry.rows, entry.cols);
+    pattern.rule = Rule::parse(entry.rule);
+    mt19937 random(seed);
+    for (int i = 0; i < entry.rows; ++i) {
+        for (int j = 0; j < entry.cols; ++j) {
+            int draw = static_cast<int>(random() % 100);
+            if (draw < obstaclePercent) {
+                pattern.obstacles.set(i, j);
+            }
+            else if (draw < obstaclePercent + alivePercent) {
+                pattern.alive.set(i, j);
+            }
+        }
+    }
+    return pattern;
+}
+
+} // namespace
+
+// Lit un corpus
+vector<CorpusEntry> Corpus::read(const string& filename) {
+    ifstream file(filename);
+    if (!file) {
+        throw runtime_error("Impossible d'ouvrir le corpus : " + filename);
+    }
+    vector<CorpusEntry> entries;
+    string text;
+    for (int line = 1; getline(file, text); ++line) {
+        size_t comment = text.find('#');
+        if (comment != string::npos) {
+            text.erase(comment);
+        }
+        istringstream in(text);
+        CorpusEntry entry;
+        string topology;
+        string hash;
+        Checkpoint checkpoint;
+        if (!(in >> entry.name)) {
+            continue; // Ligne vide
+        }
+        if (!(in >> entry.source >> entry.rows >> entry.cols >> entry.rule >> topology >> checkpoint.generation >>
+              checkpoint.population >> hash) || entry.rows <= 0 || entry.cols <= 0 || checkpoint.generation < 0 ||
+            (topology != "plat" && topology != "torique")) {
+            throw corpusError(filename, line, "référence mal formée");
+        }
+        try {
+            Rule::parse(entry.rule);
+            size_t end = 0;
+            checkpoint.hash = stoull(hash, &end, 16);
+            if (end != hash.size()) {
+                throw invalid_argument(hash);
+            }
+        }
+        catch (const exception&) {
+            throw corpusError(filename, line, "règle ou empreinte invalide");
+        }
+        entry.toric = topology == "torique";
+        entry.line = line;
+
+        if (!entries.empty() && entries.back().name == entry.name) {
+            CorpusEntry& previous = entries.back();
+            if (previous.source != entry.source || previous.rows != entry.rows || previous.cols != entry.cols ||
+                previous.rule != entry.rule || previous.toric != entry.toric) {
+                throw corpusError(filename, line, "grille différente pour " + entry.name);
+            }
+            if (checkpoint.generation <= previous.checkpoints.back().generation) {
+                throw corpusError(filename, line, "générations non croissantes pour " + entry.name);
+            }
+            previous.checkpoints.push_back(checkpoint);
+        }
+        else {
+            entry.checkpoints.push_back(checkpoint);
+            entries.push_back(entry);
+        }
+    }
+    return entries;
+}
+
+// Construit la grille initiale d'une référence
+void Corpus::load(const CorpusEntry& entry, const string& directory, Grid& grid) {
+    if (entry.source.compare(0, sizeof(SOUP_PREFIX) - 1, SOUP_PREFIX) == 0) {
+        grid.loadPattern(soup(entry));
+    }
+    else {
+        string filename = directory.empty() ? entry.source : directory + "/" + entry.source;
+        if (hasExtension(filename, ".rle")) {
+            grid.initializeFromRLE(filename); // Motif centré
+        }
+        else if (hasExtension(filename, ".mc")) {
+            grid.initializeFromMacrocell(filename);
+        }
+        else {
+            grid.initializeFromInput(filename); // Format texte (« 1 », « X », « 0 »)
+        }
+    }
+    if (grid.getRows() != entry.rows || grid.getCols() != entry.cols) {
+        throw runtime_error("Le motif de " + entry.name + " ne tient pas dans la grille.");
+    }
+    grid.setRule(Rule::parse(entry.rule));
+    grid.setToric(entry.toric);
+}
+
+// Met en forme une référence au format du corpus
+string Corpus::format(const CorpusEntry& entry) {
+    string text;
+    for (const Checkpoint& checkpoint : entry.checkpoints) {
+        char line[512];
+        snprintf(line, sizeof(line), "%-24s %-32s %5d %5d  %-14s %-8s %6lld %7lld  %016llx\n", entry.name.c_str(),
+                 entry.source.c_str(), entry.rows, entry.cols, entry.rule.c_str(), entry.toric ? "torique" : "plat",
+                 checkpoint.generation, checkpoint.population, static_cast<unsigned long long>(checkpoint.hash));
+        text += line;
+    }
+    return text;
+}
+
+// Nombre de cellules vivantes de la grille
+long long Corpus::population(const Grid& grid) {
+    long long count = 0;
+    for (int i = 0; i < grid.getRows(); ++i) {
+        for (int j = 0; j < grid.getCols(); ++j) {
+            count += grid.getCellState(i, j) == VIVANT;
+        }
+    }
+    return count;
+}
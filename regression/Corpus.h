@@ -0,0 +1,77 @@
+// regression/Corpus.h
+#ifndef CORPUS_H
+#define CORPUS_H
+
+#include "Grid.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief État de référence d'une grille à une génération donnée.
+ */
+struct Checkpoint {
+    long long generation;
+    long long population; // Cellules vivantes
+    std::uint64_t hash; // Empreinte de la grille (Grid::hash)
+};
+
+/**
+ * @brief Grille de référence du corpus et ses états attendus.
+ */
+struct CorpusEntry {
+    std::string name;
+    std::string source; // Fichier (relatif au corpus) ou « soupe:<vivantes %>:<graine>[:<obstacles %>] »
+    int rows;
+    int cols;
+    std::string rule;
+    bool toric;
+    std::vector<Checkpoint> checkpoints; // Par générations croissantes
+    int line; // Ligne de la première référence dans le corpus
+};
+
+/**
+ * @brief Corpus de non-régression : grilles de référence et empreintes attendues.
+ *
+ * Chaque ligne non vide et hors commentaire (« # ») donne une référence :
+ *
+ *   nom source lignes colonnes règle plat|torique génération population empreinte
+ *
+ * Les lignes consécutives de même nom décrivent la même grille à des
+ * générations croissantes. Les soupes aléatoires sont tirées directement
+ * des sorties de std::mt19937 (et non d'une distribution de la
+ * bibliothèque standard) pour être identiques sur toutes les plateformes.
+ */
+class Corpus {
+public:
+    /**
+     * @brief Lit un corpus.
+     *
+     * @param filename Nom du fichier.
+     * @return Les grilles de référence, dans l'ordre du fichier.
+     * @throws std::runtime_error Si le fichier est introuvable ou mal formé.
+     */
+    static std::vector<CorpusEntry> read(const std::string& filename);
+
+    /**
+     * @brief Construit la grille initiale d'une référence.
+     *
+     * @param entry Référence du corpus.
+     * @param directory Dossier du corpus (préfixe des fichiers sources).
+     * @param grid Grille aux dimensions de la référence ; règle et topologie sont appliquées.
+     * @throws std::runtime_error Si la source ne peut pas être lue.
+     */
+    static void load(const CorpusEntry& entry, const std::string& directory, Grid& grid);
+
+    /**
+     * @brief Met en forme une référence au format du corpus (une ligne par état).
+     */
+    static std::string format(const CorpusEntry& entry);
+
+    /**
+     * @brief Nombre de cellules vivantes de la grille.
+     */
+    static long long population(const Grid& grid);
+};
+
+#endif // CORPUS_H
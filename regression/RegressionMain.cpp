@@ -0,0 +1,274 @@
+// regression/RegressionMain.cpp
+#include "Corpus.h"
+#include "Log.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <map>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+
+using namespace std;
+
+namespace {
+
+/**
+ * @brief Manière de calculer les générations : chaque noyau doit donner les mêmes empreintes.
+ */
+struct Kernel {
+    const char* name;
+    unsigned threads;
+    GridSnapshot::Counters counters;
+};
+
+const char ENGINE[] = "flat"; // Seul moteur disponible (voir HeadlessOptions)
+const Kernel KERNELS[] = {
+    { "sequentiel", 1, GridSnapshot::AUCUN },
+    { "parallele", 4, GridSnapshot::AUCUN }, // Bandes de tuiles sur plusieurs threads
+    { "compteurs", 1, GridSnapshot::ACTIVITE } // Compteurs par cellule calculés dans la même boucle
+};
+
+struct Options {
+    string corpus;
+    string kernel; // Vide : tous les noyaux
+    string baseline; // Débits de référence (vide : pas de contrôle du débit ; obligatoires sauf avec --update-baseline)
+    double tolerance; // Baisse de débit tolérée
+    bool updateBaseline;
+    bool print; // Afficher les états calculés au format du corpus au lieu de les contrôler
+
+    Options() : tolerance(0.3), updateBaseline(false), print(false) {}
+};
+
+/**
+ * @brief Cellules calculées et durée cumulées d'un noyau.
+ */
+struct Throughput {
+    double cells;
+    double seconds;
+
+    Throughput() : cells(0.0), seconds(0.0) {}
+    double rate() const { return seconds > 0.0 ? cells / seconds : 0.0; }
+};
+
+string usage(const string& program) {
+    return "Utilisation : " + program + " --corpus FICHIER [options]\n"
+           "Contrôle les empreintes du corpus de non-régression avec chaque noyau de simulation.\n"
+           "\n"
+           "  --corpus FICHIER       corpus de référence (regression/corpus.txt)\n"
+           "  --kernel NOM           un seul noyau : sequentiel, parallele ou compteurs\n"
+           "  --baseline FICHIER     débits de référence par noyau (regression/debits.txt)\n"
+           "  --tolerance X          baisse de débit tolérée (0.3 : 30 %)\n"
+           "  --update-baseline      créer ou remplacer les débits de référence\n"
+           "  --print                afficher les états calculés au format du corpus\n";
+}
+
+Options parse(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        string option = argv[i];
+        if (option == "--update-baseline") {
+            options.updateBaseline = true;
+            continue;
+        }
+        if (option == "--print") {
+            options.print = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            throw runtime_error("Option inconnue ou sans valeur : " + option);
+        }
+        string value = argv[++i];
+        if (option == "--corpus") options.corpus = value;
+        else if (option == "--kernel") options.kernel = value;
+        else if (option == "--baseline") options.baseline = value;
+        else if (option == "--tolerance") {
+            istringstream in(value);
+            if (!(in >> options.tolerance) || !in.eof() || options.tolerance < 0.0 || options.tolerance >= 1.0) {
+                throw runtime_error("Valeur invalide pour --tolerance : " + value);
+            }
+        }
+        else {
+            throw runtime_error("Option inconnue : " + option);
+        }
+    }
+    if (options.corpus.empty()) {
+        throw runtime_error("Le corpus est obligatoire (--corpus).");
+    }
+    return options;
+}
+
+string directoryOf(const string& filename) {
+    size_t slash = filename.find_last_of("/\\");
+    return slash == string::npos ? string() : filename.substr(0, slash);
+}
+
+string hexadecimal(uint64_t value) {
+    char text[24];
+    snprintf(text, sizeof(text), "%016llx", static_cast<unsigned long long>(value));
+    return text;
+}
+
+// Calcule une référence avec un noyau ; retourne le nombre d'écarts (les états calculés sont écrits dans computed)
+int runEntry(const CorpusEntry& entry, const string& directory, const Kernel& kernel, bool report, CorpusEntry& computed,
+             Throughput& throughput) {
+    Grid grid(entry.rows, entry.cols);
+    Corpus::load(entry, directory, grid);
+    grid.setThreads(kernel.threads);
+    grid.setHistoryLimit(1);
+    grid.setCounterMode(kernel.counters);
+
+    int failures = 0;
+    long long population = Corpus::population(grid);
+    computed = entry;
+    computed.checkpoints.clear();
+    for (const Checkpoint& expected : entry.checkpoints) {
+        // Seules les mises à jour sont chronométrées ; le bilan de chaque génération est contrôlé au passage
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        long long generations = expected.generation - grid.getGeneration();
+        for (long long g = 0; g < generations; ++g) {
+            grid.update();
+            const GenerationStats& stats = grid.getLastStats();
+            population += stats.births - stats.deaths;
+            if (stats.population != population && failures++ == 0 && report) {
+                cout << "[ECHEC] " << entry.name << " (" << kernel.name << ") génération " << grid.getGeneration()
+                     << " : bilan incohérent (population " << stats.population << ", attendue " << population << ")" << endl;
+            }
+        }
+        throughput.seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        throughput.cells += static_cast<double>(generations) * entry.rows * entry.cols;
+
+        Checkpoint actual = { grid.getGeneration(), Corpus::population(grid), grid.hash() };
+        computed.checkpoints.push_back(actual);
+        if (actual.population != expected.population || actual.hash != expected.hash) {
+            ++failures;
+            if (report) {
+                cout << "[ECHEC] " << entry.name << " (" << kernel.name << ") génération " << actual.generation
+                     << " : population " << actual.population << " (attendue " << expected.population << "), empreinte "
+                     << hexadecimal(actual.hash) << " (attendue " << hexadecimal(expected.hash) << ")" << endl;
+            }
+        }
+        population = actual.population;
+    }
+    return failures;
+}
+
+// Lit les débits de référence : « noyau cellules/s » par ligne, '#' commence un commentaire
+map<string, double> readBaseline(const string& filename) {
+    ifstream file(filename);
+    if (!file) {
+        throw runtime_error("Débits de référence introuvables : " + filename + " (--update-baseline pour les créer)");
+    }
+    map<string, double> rates;
+    string text;
+    for (int line = 1; getline(file, text); ++line) {
+        size_t comment = text.find('#');
+        if (comment != string::npos) {
+            text.erase(comment);
+        }
+        istringstream in(text);
+        string kernel;
+        double rate = 0.0;
+        if (!(in >> kernel)) {
+            continue; // Ligne vide
+        }
+        if (!(in >> rate) || rate <= 0.0) {
+            throw runtime_error("Débit de référence invalide ligne " + to_string(line) + " : " + filename);
+        }
+        rates[kernel] = rate;
+    }
+    if (rates.empty()) {
+        throw runtime_error("Aucun débit de référence dans " + filename);
+    }
+    return rates;
+}
+
+void writeBaseline(const string& filename, const map<string, Throughput>& measured) {
+    ofstream file(filename);
+    for (const auto& kernel : measured) {
+        file << kernel.first << ' ' << kernel.second.rate() << '\n';
+    }
+    if (!file) {
+        throw runtime_error("Impossible d'écrire les débits de référence : " + filename);
+    }
+}
+
+int run(const Options& options) {
+    vector<CorpusEntry> entries = Corpus::read(options.corpus);
+    string directory = directoryOf(options.corpus);
+
+    int failures = 0;
+    map<string, Throughput> measured;
+    for (const Kernel& kernel : KERNELS) {
+        if (!options.kernel.empty() && options.kernel != kernel.name) {
+            continue;
+        }
+        Throughput& throughput = measured[kernel.name];
+        for (const CorpusEntry& entry : entries) {
+            CorpusEntry computed;
+            int entryFailures = runEntry(entry, directory, kernel, !options.print, computed, throughput);
+            failures += entryFailures;
+            if (options.print) {
+                cout << Corpus::format(computed);
+            }
+            else if (entryFailures == 0) {
+                cout << "[ok] " << entry.name << " (" << ENGINE << "/" << kernel.name << ")" << endl;
+            }
+        }
+        if (options.print) {
+            return 0; // Un seul noyau suffit pour produire les références
+        }
+        cout << "Débit " << ENGINE << "/" << kernel.name << " : " << throughput.rate() << " cellules/s" << endl;
+    }
+    if (measured.empty()) {
+        throw runtime_error("Noyau inconnu : " + options.kernel + " (sequentiel, parallele ou compteurs)");
+    }
+
+    if (!options.baseline.empty()) {
+        if (options.updateBaseline) {
+            writeBaseline(options.baseline, measured);
+            cout << "Débits de référence enregistrés dans " << options.baseline << endl;
+        }
+        else {
+            map<string, double> baseline = readBaseline(options.baseline);
+            for (const auto& kernel : measured) {
+                auto reference = baseline.find(kernel.first);
+                if (reference == baseline.end()) {
+                    ++failures;
+                    cout << "[ECHEC] pas de débit de référence pour " << kernel.first << endl;
+                    continue;
+                }
+                double minimum = reference->second * (1.0 - options.tolerance);
+                if (kernel.second.rate() < minimum) {
+                    ++failures;
+                    cout << "[ECHEC] débit " << kernel.first << " : " << kernel.second.rate() << " cellules/s, minimum "
+                         << minimum << " (référence " << reference->second << ")" << endl;
+                }
+            }
+        }
+    }
+
+    cout << (failures == 0 ? "Corpus conforme." : "Écarts : " + to_string(failures)) << endl;
+    return failures == 0 ? 0 : 1;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        string option = argv[i];
+        if (option == "-h" || option == "--help") {
+            cout << usage(argv[0]);
+            return 0;
+        }
+    }
+    Log::setLevel(Log::AVERTISSEMENT); // Les messages de chargement fausseraient les mesures
+    try {
+        return run(parse(argc, argv));
+    }
+    catch (const runtime_error& e) {
+        Log::flush();
+        cerr << "Erreur : " << e.what() << endl;
+        return 2;
+    }
+}
@@ -1,88 +0,0 @@
-// services/Game.h
-#ifndef GAME_H
-#define GAME_H
-
-#include "Grid.h"
-#include "SimulationInterface.h"
-#include <memory> // Pour std::unique_ptr
-
-/**
- * @brief Classe principale contrlant le flux de l'application.
- *
- * Cette classe gre la slection du mode d'interface (console ou graphique),
- * l'initialisation de la grille, et l'excution de la simulation via
- * l'interface slectionne.
- */
-class Game {
-public:
-    /**
-     * @brief Excute le jeu.
-     */
-    void run();
-};
-
-#endif // GAME_H
-#pragma once
-// services/Game.cpp
-
-#include "Console.h"
-#include "Graphics.h"
-#include <iostream>
-#include <string>
-#include <memory>
-
-using namespace std;
-
-void Game::run() {
-    int rows = 25;
-    int cols = 25;
-    int cellSize = 19;
-    int maxIterations = 0;
-    int delay = 500; // Temps d'attente en millisecondes pour ralentir les itrations
-    string mode;
-    string filename;
-
-    cout << "Choisissez le mode (console insrez C et pour le mode graphique insrez G) : ";
-    cin >> mode;
-
-    if (mode != "C" && mode != "G") {
-        cout << "Mode invalide, veuillez redmarrer et choisir 'C' ou 'G'." << endl;
-        return;
-    }
-
-    cout << "Entrez le dlai entre chaque itration en millisecondes (par dfaut 500 ms) : ";
-    cin >> delay;
-
-    Grid grid(rows, cols);
-
-    // Utilisation de std::unique_ptr pour la gestion de la mmoire
-    unique_ptr<SimulationInterface> interface;
-
-    if (mode == "G") {
-        cout << "Entrez le nombre d'itrations (0 pour une simulation infinie) : ";
-        cin >> maxIterations;
-
-        interface = make_unique<GraphicsInterface>();
-    }
-    else if (mode == "C") {
-        cout << "Entrez le nom du fichier pour initialiser la grille (ou appuyez sur Entre pour crer une grille vide) : ";
-        cin.ignore(); // Pour ignorer le caractre de nouvelle ligne restant dans le buffer
-        getline(cin, filename);
-
-        try {
-            if (!filename.empty()) {
-                grid.initializeFromInput(filename);
-            }
-        }
-        catch (const runtime_error& e) {
-            cout << "Erreur : " << e.what() << endl;
-            return;
-        }
-
-        interface = make_unique<ConsoleInterface>();
-    }
-
-    if (interface) {
-        interface->run(grid, delay, maxIterations);
-    }
-}
\ No newline at end of file
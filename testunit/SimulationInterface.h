@@ -1,28 +0,0 @@
-#pragma once
-// interfaces/SimulationInterface.h
-#ifndef SIMULATIONINTERFACE_H
-#define SIMULATIONINTERFACE_H
-
-#include "Grid.h"
-
-/**
- * @brief Classe de base abstraite pour les interfaces de simulation.
- *
- * Cette classe dfinit une interface commune pour diffrentes implmentations
- * de l'interface utilisateur de la simulation (console, graphique, etc.).
- */
-class SimulationInterface {
-public:
-    virtual ~SimulationInterface() = default;
-
-    /**
-     * @brief Excute la simulation.
-     *
-     * @param grid Rfrence vers la grille de simulation.
-     * @param delay Dlai entre chaque itration en millisecondes.
-     * @param maxIterations Nombre maximal d'itrations (0 pour infini).
-     */
-    virtual void run(Grid& grid, int delay, int maxIterations) = 0;
-};
-
-#endif // SIMULATIONINTERFACE_H
\ No newline at end of file
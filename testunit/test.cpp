@@ -1,5 +1,5 @@
 // test_Grid.cpp
-#include "pch.h" // Inclure les prcompils si ncessaire
+#include "pch.h" // Inclure les précompilés si nécessaire
 #include "Grid.h"
 #include <gtest/gtest.h>
 #include <fstream>
@@ -18,7 +18,7 @@ protected:
     }
 
     void TearDown() override {
-        // Nettoyage aprs chaque test
+        // Nettoyage après chaque test
         delete grid;
     }
 
@@ -32,18 +32,18 @@ TEST_F(GridTests, TestConstructor) {
     EXPECT_EQ(grid->getRows(), 5);
     EXPECT_EQ(grid->getCols(), 10);
 
-    // Vrifier que toutes les cellules sont initialement VIDE
+    // Vérifier que toutes les cellules sont initialement VIDE
     for (int i = 0; i < grid->getRows(); ++i) {
         for (int j = 0; j < grid->getCols(); ++j) {
-            EXPECT_EQ(grid->getCellState(i, j), VIDE) << "Cellule (" << i << ", " << j << ") devrait tre VIDE";
+            EXPECT_EQ(grid->getCellState(i, j), VIDE) << "Cellule (" << i << ", " << j << ") devrait être VIDE";
         }
     }
 }
 
-// Test de l'initialisation  partir d'un fichier
+// Test de l'initialisation à partir d'un fichier
 TEST_F(GridTests, TestInitializeFromInput) {
     std::ofstream outFile("Grid.txt");
-    // criture d'une configuration de 5 lignes et 10 colonnes
+    // Écriture d'une configuration de 5 lignes et 10 colonnes
     // Exemple de configuration avec quelques cellules VIVANT et OBSTACLE
     outFile << "0 0 1 0 0 0 0 0 0 0\n";
     outFile << "0 0 0 1 0 0 0 0 0 0\n";
@@ -52,25 +52,25 @@ TEST_F(GridTests, TestInitializeFromInput) {
     outFile << "0 0 0 0 0 0 0 0 0 0\n";
     outFile.close();
 
-    // Initialiser la grille  partir du fichier corrig
+    // Initialiser la grille à partir du fichier corrigé
     grid->initializeFromInput("Grid.txt"); // Correction ici
 
-    // Vrifier les cellules spcifiques
+    // Vérifier les cellules spécifiques
     EXPECT_EQ(grid->getCellState(0, 2), VIVANT);
     EXPECT_EQ(grid->getCellState(1, 3), VIVANT);
     EXPECT_EQ(grid->getCellState(2, 1), VIVANT);
     EXPECT_EQ(grid->getCellState(2, 2), OBSTACLE);
     EXPECT_EQ(grid->getCellState(2, 3), VIVANT);
 
-    // Vrifier que les autres cellules sont VIDE
+    // Vérifier que les autres cellules sont VIDE
     for (int i = 0; i < grid->getRows(); ++i) {
         for (int j = 0; j < grid->getCols(); ++j) {
             if ((i == 0 && j == 2) ||
                 (i == 1 && j == 3) ||
                 (i == 2 && (j == 1 || j == 2 || j == 3))) {
-                continue; // Ces cellules ont dj t vrifies
+                continue; // Ces cellules ont déjà été vérifiées
             }
-            EXPECT_EQ(grid->getCellState(i, j), VIDE) << "Cellule (" << i << ", " << j << ") devrait tre VIDE";
+            EXPECT_EQ(grid->getCellState(i, j), VIDE) << "Cellule (" << i << ", " << j << ") devrait être VIDE";
         }
     }
 
@@ -78,7 +78,7 @@ TEST_F(GridTests, TestInitializeFromInput) {
     remove("Grid.txt");
 }
 
-// Test de la mise  jour de la grille avec un oscillateur "blinker"
+// Test de la mise à jour de la grille avec un oscillateur "blinker"
 TEST_F(GridTests, TestUpdate) {
     // Initialiser la grille avec un oscillateur "blinker" vertical
     std::ofstream outFile("Grid.txt");
@@ -91,25 +91,25 @@ TEST_F(GridTests, TestUpdate) {
 
     grid->initializeFromInput("Grid.txt"); // Utiliser le bon nom de fichier
 
-    // Effectuer une mise  jour pour passer  l'tat horizontal
+    // Effectuer une mise à jour pour passer à l'état horizontal
     grid->update();
 
-    // Vrifier l'tat aprs la mise  jour (blinker horizontal)
+    // Vérifier l'état après la mise à jour (blinker horizontal)
     EXPECT_EQ(grid->getCellState(1, 1), VIVANT);
     EXPECT_EQ(grid->getCellState(1, 2), VIVANT);
     EXPECT_EQ(grid->getCellState(1, 3), VIVANT);
 
-    // Vrifier que les anciennes cellules verticales sont dsormais VIDE
+    // Vérifier que les anciennes cellules verticales sont désormais VIDE
     EXPECT_EQ(grid->getCellState(0, 2), VIDE);
     EXPECT_EQ(grid->getCellState(2, 2), VIDE);
 
-    // Vrifier que les autres cellules restent VIDE ou OBSTACLE
+    // Vérifier que les autres cellules restent VIDE ou OBSTACLE
     for (int i = 0; i < grid->getRows(); ++i) {
         for (int j = 0; j < grid->getCols(); ++j) {
             if ((i == 1 && (j == 1 || j == 2 || j == 3))) {
-                continue; // Ces cellules ont dj t vrifies
+                continue; // Ces cellules ont déjà été vérifiées
             }
-            EXPECT_EQ(grid->getCellState(i, j), VIDE) << "Cellule (" << i << ", " << j << ") devrait tre VIDE";
+            EXPECT_EQ(grid->getCellState(i, j), VIDE) << "Cellule (" << i << ", " << j << ") devrait être VIDE";
         }
     }
 
@@ -117,9 +117,9 @@ TEST_F(GridTests, TestUpdate) {
     remove("Grid.txt");
 }
 
-// Test de l'annulation de la dernire mise  jour
+// Test de l'annulation de la dernière mise à jour
 TEST_F(GridTests, TestUndo) {
-    // Initialiser la grille avec un tat initial
+    // Initialiser la grille avec un état initial
     std::ofstream outFile("Grid.txt");
     outFile << "0 0 1 0 0 0 0 0 0 0\n";
     outFile << "0 0 1 0 0 0 0 0 0 0\n";
@@ -130,33 +130,33 @@ TEST_F(GridTests, TestUndo) {
 
     grid->initializeFromInput("Grid.txt");
 
-    // Effectuer une mise  jour
+    // Effectuer une mise à jour
     grid->update();
 
-    // Vrifier l'tat aprs la mise  jour
+    // Vérifier l'état après la mise à jour
     EXPECT_EQ(grid->getCellState(1, 1), VIVANT);
     EXPECT_EQ(grid->getCellState(1, 2), VIVANT);
     EXPECT_EQ(grid->getCellState(1, 3), VIVANT);
     EXPECT_EQ(grid->getCellState(0, 2), VIDE);
     EXPECT_EQ(grid->getCellState(2, 2), VIDE);
 
-    // Annuler la mise  jour
+    // Annuler la mise à jour
     grid->undo();
 
-    // Vrifier que l'tat est revenu  l'initial
+    // Vérifier que l'état est revenu à l'initial
     EXPECT_EQ(grid->getCellState(0, 2), VIVANT);
     EXPECT_EQ(grid->getCellState(1, 2), VIVANT);
     EXPECT_EQ(grid->getCellState(2, 2), VIVANT);
 
-    // Vrifier que les autres cellules sont VIDE
+    // Vérifier que les autres cellules sont VIDE
     for (int i = 0; i < grid->getRows(); ++i) {
         for (int j = 0; j < grid->getCols(); ++j) {
             if ((i == 0 && j == 2) ||
                 (i == 1 && j == 2) ||
                 (i == 2 && j == 2)) {
-                continue; // Ces cellules ont dj t vrifies
+                continue; // Ces cellules ont déjà été vérifiées
             }
-            EXPECT_EQ(grid->getCellState(i, j), VIDE) << "Cellule (" << i << ", " << j << ") devrait tre VIDE";
+            EXPECT_EQ(grid->getCellState(i, j), VIDE) << "Cellule (" << i << ", " << j << ") devrait être VIDE";
         }
     }
 
@@ -164,7 +164,7 @@ TEST_F(GridTests, TestUndo) {
     remove("Grid.txt");
 }
 
-// Test de la mthode hasStableState avec une configuration stable
+// Test de la méthode hasStableState avec une configuration stable
 TEST_F(GridTests, TestHasStableStateWithStableConfiguration) {
     // Initialiser la grille avec un bloc stable
     std::ofstream outFile("Grid.txt");
@@ -178,20 +178,20 @@ TEST_F(GridTests, TestHasStableStateWithStableConfiguration) {
 
     grid->initializeFromInput("Grid.txt");
 
-    // Avant la mise  jour, la grille ne devrait pas tre stable
+    // Avant la mise à jour, la grille ne devrait pas être stable
     EXPECT_FALSE(grid->hasStableState());
 
-    // Effectuer une mise  jour
+    // Effectuer une mise à jour
     grid->update();
 
-    // Aprs la mise  jour, la grille devrait tre stable
+    // Après la mise à jour, la grille devrait être stable
     EXPECT_TRUE(grid->hasStableState());
 
     // Nettoyage
     remove("Grid.txt");
 }
 
-// Test de la mthode hasStableState avec un oscillateur
+// Test de la méthode hasStableState avec un oscillateur
 TEST_F(GridTests, TestHasStableStateWithOscillator) {
     // Initialiser la grille avec un oscillateur "blinker" vertical
     std::ofstream outFile("Grid.txt");
@@ -204,32 +204,32 @@ TEST_F(GridTests, TestHasStableStateWithOscillator) {
 
     grid->initializeFromInput("Grid.txt");
 
-    // Avant la mise  jour, la grille ne devrait pas tre stable
+    // Avant la mise à jour, la grille ne devrait pas être stable
     EXPECT_FALSE(grid->hasStableState());
 
-    // Effectuer une premire mise  jour
+    // Effectuer une première mise à jour
     grid->update();
 
-    // Aprs une mise  jour, la grille ne devrait toujours pas tre stable
+    // Après une mise à jour, la grille ne devrait toujours pas être stable
     EXPECT_FALSE(grid->hasStableState());
 
-    // Effectuer une seconde mise  jour pour revenir  l'tat initial
+    // Effectuer une seconde mise à jour pour revenir à l'état initial
     grid->update();
 
-    // Maintenant, la grille ne devrait pas tre stable (car elle oscille entre deux tats)
+    // Maintenant, la grille ne devrait pas être stable (car elle oscille entre deux états)
     EXPECT_FALSE(grid->hasStableState());
 
     // Nettoyage
     remove("Grid.txt");
 }
 
-// Test de basculement de l'tat d'une cellule
+// Test de basculement de l'état d'une cellule
 TEST_F(GridTests, TestToggleCell) {
-    // Basculer une cellule de VIDE  VIVANT
+    // Basculer une cellule de VIDE à VIVANT
     grid->toggleCell(2, 2, 1, VIVANT); // Supposons cellSize = 1 pour simplifier
     EXPECT_EQ(grid->getCellState(2, 2), VIVANT);
 
-    // Basculer la mme cellule de VIVANT  VIDE
+    // Basculer la même cellule de VIVANT à VIDE
     grid->toggleCell(2, 2, 1, VIDE);
     EXPECT_EQ(grid->getCellState(2, 2), VIDE);
 
@@ -237,12 +237,12 @@ TEST_F(GridTests, TestToggleCell) {
     grid->toggleCell(1, 1, 1, OBSTACLE);
     EXPECT_EQ(grid->getCellState(1, 1), OBSTACLE);
 
-    // Tenter de basculer une cellule en VIVANT qui est dj un OBSTACLE
+    // Tenter de basculer une cellule en VIVANT qui est déjà un OBSTACLE
     grid->toggleCell(1, 1, 1, VIVANT);
-    EXPECT_EQ(grid->getCellState(1, 1), OBSTACLE) << "Les obstacles ne doivent pas tre modifiables par toggleCell sauf pour les OBSTACLE";
+    EXPECT_EQ(grid->getCellState(1, 1), OBSTACLE) << "Les obstacles ne doivent pas être modifiables par toggleCell sauf pour les OBSTACLE";
 }
 
-// Test de la mthode print (capturer la sortie standard)
+// Test de la méthode print (capturer la sortie standard)
 TEST_F(GridTests, TestPrint) {
     // Rediriger la sortie standard
     std::streambuf* originalCoutBuffer = std::cout.rdbuf();
@@ -260,7 +260,7 @@ TEST_F(GridTests, TestPrint) {
     // Restaurer la sortie standard
     std::cout.rdbuf(originalCoutBuffer);
 
-    // Vrifier la sortie capture
+    // Vérifier la sortie capturée
     std::string expectedOutput =
         "1 0 0 0 0 0 0 0 0 0 \n"
         "0 X 0 0 0 0 0 0 0 0 \n"
@@ -272,11 +272,11 @@ TEST_F(GridTests, TestPrint) {
     EXPECT_EQ(capturedOutput.str(), expectedOutput);
 }
 
-// Main pour excuter tous les tests
+// Main pour exécuter tous les tests
 int main(int argc, char** argv) {
-    // Configuration pour afficher les caractres UTF-8 correctement dans la console Windows
+    // Configuration pour afficher les caractères UTF-8 correctement dans la console Windows
 #ifdef _WIN32
-    // Vous pouvez ajouter des configurations spcifiques  Windows ici si ncessaire
+    // Vous pouvez ajouter des configurations spécifiques à Windows ici si nécessaire
 #endif
 
     ::testing::InitGoogleTest(&argc, argv);
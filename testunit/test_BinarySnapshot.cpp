@@ -0,0 +1,130 @@
+// test_BinarySnapshot.cpp
+#include "pch.h"
+#include "Grid.h"
+#include "BinarySnapshot.h"
+#include "Trajectory.h"
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+// Soupe aléatoire reproductible avec obstacles
+void fillRandom(Grid& grid, unsigned seed) {
+    Pattern pattern;
+    pattern.alive = BitPlane(grid.getRows(), grid.getCols());
+    pattern.obstacles = BitPlane(grid.getRows(), grid.getCols());
+    pattern.rule = Rule::parse("B36/S23");
+    std::mt19937 random(seed);
+    for (int i = 0; i < grid.getRows(); ++i) {
+        for (int j = 0; j < grid.getCols(); ++j) {
+            unsigned draw = random() % 100;
+            if (draw < 3) pattern.obstacles.set(i, j);
+            else if (draw < 35) pattern.alive.set(i, j);
+        }
+    }
+    grid.loadPattern(pattern);
+}
+
+std::string readFile(const char* filename) {
+    std::ifstream file(filename, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void writeFile(const char* filename, const std::string& content) {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+} // namespace
+
+// Enregistrer puis recharger redonne la grille, sa règle, sa topologie et sa génération
+TEST(BinarySnapshotTests, TestRoundTrip) {
+    for (bool compress : { true, false }) {
+        Grid grid(130, 97);
+        fillRandom(grid, 11);
+        grid.setToric(true);
+        for (int k = 0; k < 12; ++k) {
+            grid.update();
+        }
+        grid.saveBinary("Snapshot.golb", compress);
+
+        Grid loaded(4, 4);
+        loaded.loadBinary("Snapshot.golb");
+        EXPECT_EQ(loaded.getRows(), 130);
+        EXPECT_EQ(loaded.getCols(), 97);
+        EXPECT_EQ(loaded.hash(), grid.hash()) << (compress ? "compressé" : "non compressé");
+        EXPECT_EQ(loaded.getRule(), grid.getRule());
+        EXPECT_TRUE(loaded.isToric());
+        EXPECT_EQ(loaded.getGeneration(), 12);
+
+        BinarySnapshot snapshot("Snapshot.golb");
+        EXPECT_EQ(snapshot.getHash(), grid.hash());
+    }
+}
+
+// Un fichier tronqué, corrompu ou étranger est refusé sans modifier la grille
+TEST(BinarySnapshotTests, TestTruncatedOrCorruptRejected) {
+    Grid grid(64, 64);
+    fillRandom(grid, 5);
+    grid.saveBinary("Snapshot.golb");
+    std::string content = readFile("Snapshot.golb");
+
+    Grid target(8, 8);
+    target.toggleCell(1, 1, 1, VIVANT);
+    std::uint64_t before = target.hash();
+
+    writeFile("Truncated.golb", content.substr(0, content.size() / 2));
+    EXPECT_THROW(target.loadBinary("Truncated.golb"), std::runtime_error);
+
+    writeFile("Truncated.golb", content.substr(0, 10));
+    EXPECT_THROW(target.loadBinary("Truncated.golb"), std::runtime_error);
+
+    std::string corrupt = content;
+    corrupt[corrupt.size() - 5] ^= 0x5A;
+    writeFile("Corrupt.golb", corrupt);
+    EXPECT_THROW(target.loadBinary("Corrupt.golb"), std::runtime_error);
+
+    writeFile("Foreign.golb", "x = 3, y = 1\n3o!\n");
+    EXPECT_THROW(target.loadBinary("Foreign.golb"), std::runtime_error);
+    EXPECT_THROW(target.loadBinary("Absent.golb"), std::runtime_error);
+
+    EXPECT_EQ(target.getRows(), 8);
+    EXPECT_EQ(target.hash(), before);
+}
+
+// Charger un fichier fait repartir la génération de celle du fichier, ou de 0 sans numéro de génération
+TEST(BinarySnapshotTests, TestLoadersRestartGeneration) {
+    Grid grid(40, 40);
+    fillRandom(grid, 3);
+    for (int k = 0; k < 7; ++k) {
+        grid.update();
+    }
+    grid.saveBinary("Generation.golb");
+    grid.saveRLE("Generation.rle");
+
+    grid.recordTrajectory("Generation.golt", 4);
+    for (int k = 0; k < 5; ++k) {
+        grid.update();
+    }
+    EXPECT_EQ(grid.getGeneration(), 12);
+
+    grid.initializeFromRLE("Generation.rle");
+    EXPECT_EQ(grid.getGeneration(), 0);
+    grid.update();
+    grid.update();
+
+    // La trajectoire repart de la génération chargée, sans trou dans son index
+    grid.loadBinary("Generation.golb");
+    EXPECT_EQ(grid.getGeneration(), 7);
+    grid.update();
+    EXPECT_TRUE(grid.seekGeneration(7));
+    EXPECT_TRUE(grid.seekGeneration(8));
+    EXPECT_FALSE(grid.seekGeneration(1));
+
+    Trajectory trajectory("Generation.golt");
+    EXPECT_EQ(trajectory.getFirstGeneration(), 7);
+    EXPECT_EQ(trajectory.getLastGeneration(), 8);
+}
@@ -0,0 +1,157 @@
+// test_Counters.cpp
+#include "pch.h"
+#include "Grid.h"
+#include "DensityMipmap.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Compteur d'une cellule lu dans les tuiles de compteurs de l'instantané
+unsigned counterAt(const GridSnapshot& snapshot, int row, int col) {
+    const int tileSize = GridSnapshot::TILE_SIZE;
+    return snapshot.getCounterTile(row / tileSize, col / tileSize)->cells[(row % tileSize) * tileSize + col % tileSize];
+}
+
+// Soupe aléatoire reproductible avec quelques obstacles (toggleCell : colonne, puis ligne)
+void fillRandom(Grid& grid, unsigned seed) {
+    std::mt19937 random(seed);
+    int rows = grid.getRows();
+    int cols = grid.getCols();
+    for (int k = 0; k < rows * cols / 3; ++k) {
+        grid.toggleCell(static_cast<int>(random() % cols), static_cast<int>(random() % rows), 1, VIVANT);
+    }
+    for (int k = 0; k < 50; ++k) {
+        grid.toggleCell(static_cast<int>(random() % cols), static_cast<int>(random() % rows), 1, OBSTACLE);
+    }
+}
+
+std::vector<unsigned> countersOf(const Grid& grid) {
+    std::vector<unsigned> counters;
+    for (int i = 0; i < grid.getRows(); ++i) {
+        for (int j = 0; j < grid.getCols(); ++j) {
+            counters.push_back(grid.getCounter(i, j));
+        }
+    }
+    return counters;
+}
+
+} // namespace
+
+// Âge et activité suivent la définition cellule par cellule, en séquentiel comme en parallèle
+TEST(CountersTests, TestMatchesReference) {
+    const int rows = 150;
+    const int cols = 130;
+    for (GridSnapshot::Counters mode : { GridSnapshot::AGE, GridSnapshot::ACTIVITE }) {
+        for (unsigned threads : { 1u, 3u }) {
+            Grid grid(rows, cols);
+            grid.setToric(true);
+            grid.setThreads(threads);
+            fillRandom(grid, 3);
+            grid.setCounterMode(mode);
+            EXPECT_EQ(grid.getCounterMode(), mode);
+
+            std::vector<unsigned> expected(static_cast<size_t>(rows) * cols, 0);
+            std::vector<CellState> before(static_cast<size_t>(rows) * cols);
+            for (int generation = 0; generation < 60; ++generation) {
+                for (int i = 0; i < rows; ++i) {
+                    for (int j = 0; j < cols; ++j) {
+                        before[static_cast<size_t>(i) * cols + j] = grid.getCellState(i, j);
+                    }
+                }
+                grid.update();
+                for (int i = 0; i < rows; ++i) {
+                    for (int j = 0; j < cols; ++j) {
+                        size_t index = static_cast<size_t>(i) * cols + j;
+                        bool wasAlive = before[index] == VIVANT;
+                        bool isAlive = grid.getCellState(i, j) == VIVANT;
+                        unsigned& value = expected[index];
+                        if (mode == GridSnapshot::AGE) {
+                            value = !isAlive ? 0 : wasAlive ? std::min(255u, value + 1) : 1;
+                        }
+                        else if (wasAlive != isAlive) {
+                            value = std::min(255u, value + Grid::HEAT_GAIN);
+                        }
+                        else {
+                            value -= (value + Grid::HEAT_DECAY - 1) / Grid::HEAT_DECAY;
+                        }
+                    }
+                }
+
+                GridSnapshot snapshot = grid.snapshot();
+                ASSERT_EQ(snapshot.getCounters(), mode);
+                for (int i = 0; i < rows; ++i) {
+                    for (int j = 0; j < cols; ++j) {
+                        unsigned value = expected[static_cast<size_t>(i) * cols + j];
+                        ASSERT_EQ(grid.getCounter(i, j), value) << "Génération " << generation + 1 << ", cellule (" << i << ", " << j << ")";
+                        ASSERT_EQ(counterAt(snapshot, i, j), value) << "Génération " << generation + 1 << ", cellule (" << i << ", " << j << ")";
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Annuler une génération rend aussi les compteurs de la génération précédente
+TEST(CountersTests, TestUndoRestoresCounters) {
+    for (GridSnapshot::Counters mode : { GridSnapshot::AGE, GridSnapshot::ACTIVITE }) {
+        Grid grid(90, 110);
+        fillRandom(grid, 8);
+        grid.setCounterMode(mode);
+        std::vector<std::vector<unsigned>> history;
+        for (int k = 0; k < 20; ++k) {
+            grid.update();
+            history.push_back(countersOf(grid));
+        }
+
+        for (int k = 18; k >= 10; --k) {
+            grid.undo();
+            ASSERT_EQ(countersOf(grid), history[k]) << "Génération " << k + 1;
+            GridSnapshot snapshot = grid.snapshot();
+            for (int i = 0; i < grid.getRows(); ++i) {
+                for (int j = 0; j < grid.getCols(); ++j) {
+                    ASSERT_EQ(counterAt(snapshot, i, j), history[k][static_cast<size_t>(i) * grid.getCols() + j]);
+                }
+            }
+        }
+
+        // Les générations recalculées après l'annulation redonnent les mêmes compteurs
+        grid.update();
+        EXPECT_EQ(countersOf(grid), history[11]);
+    }
+}
+
+// Sans compteurs, tout vaut zéro ; les sommes de la pyramide de densité suivent les compteurs
+TEST(CountersTests, TestModeSwitchAndMipmapSums) {
+    Grid grid(300, 260);
+    fillRandom(grid, 9);
+    DensityMipmap mipmap;
+    for (int generation = 0; generation < 12; ++generation) {
+        if (generation == 3) grid.setCounterMode(GridSnapshot::ACTIVITE);
+        if (generation == 7) grid.setCounterMode(GridSnapshot::AGE);
+        if (generation == 10) grid.setCounterMode(GridSnapshot::AUCUN);
+        grid.update();
+
+        GridSnapshot snapshot = grid.snapshot();
+        mipmap.update(snapshot);
+        for (int level = 1; level <= DensityMipmap::LEVELS; ++level) {
+            int side = 1 << level;
+            for (int blockRow = 0; blockRow < mipmap.getLevelRows(level); ++blockRow) {
+                for (int blockCol = 0; blockCol < mipmap.getLevelCols(level); ++blockCol) {
+                    unsigned long long sum = 0;
+                    for (int i = blockRow * side; i < std::min(grid.getRows(), (blockRow + 1) * side); ++i) {
+                        for (int j = blockCol * side; j < std::min(grid.getCols(), (blockCol + 1) * side); ++j) {
+                            sum += counterAt(snapshot, i, j);
+                        }
+                    }
+                    ASSERT_EQ(mipmap.counterSum(level, blockRow, blockCol), sum) << "Génération " << generation + 1 << ", niveau " << level;
+                }
+            }
+        }
+    }
+
+    EXPECT_EQ(grid.getCounterMode(), GridSnapshot::AUCUN);
+    std::vector<unsigned> counters = countersOf(grid);
+    EXPECT_TRUE(std::all_of(counters.begin(), counters.end(), [](unsigned value) { return value == 0; }));
+}
@@ -0,0 +1,122 @@
+// test_DeltaLog.cpp
+#include "pch.h"
+#include "Grid.h"
+#include "OutputWriter.h"
+#include "DeltaLogReader.h"
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<CellState> cellsOf(const Grid& grid) {
+    std::vector<CellState> cells;
+    for (int i = 0; i < grid.getRows(); ++i) {
+        for (int j = 0; j < grid.getCols(); ++j) {
+            cells.push_back(grid.getCellState(i, j));
+        }
+    }
+    return cells;
+}
+
+void writeFile(const char* filename, const std::string& content) {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+} // namespace
+
+// Classe de test : 25 générations d'une soupe torique écrites dans un journal delta
+class DeltaLogTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Grid grid(70, 90);
+        Pattern pattern;
+        pattern.alive = BitPlane(70, 90);
+        pattern.obstacles = BitPlane(70, 90);
+        std::mt19937 random(21);
+        for (int i = 0; i < 70; ++i) {
+            for (int j = 0; j < 90; ++j) {
+                unsigned draw = random() % 100;
+                if (draw < 2) pattern.obstacles.set(i, j);
+                else if (draw < 30) pattern.alive.set(i, j);
+            }
+        }
+        grid.loadPattern(pattern);
+        grid.setToric(true);
+
+        OutputWriter writer("Output.delta", OutputWriter::DELTA, 5);
+        for (int k = 0; k <= 24; ++k) {
+            writer.write(grid.snapshot(), grid.getGeneration());
+            states.push_back(cellsOf(grid));
+            grid.update();
+        }
+        ASSERT_TRUE(writer.close());
+    }
+
+    std::vector<std::vector<CellState>> states; // États attendus, par génération
+};
+
+// Chaque génération reconstruite (image clé et deltas) est identique à celle qui a été écrite
+TEST_F(DeltaLogTests, TestRoundTrip) {
+    DeltaLogReader log("Output.delta");
+    EXPECT_EQ(log.getRows(), 70);
+    EXPECT_EQ(log.getCols(), 90);
+    EXPECT_EQ(log.getFirstGeneration(), 0);
+    EXPECT_EQ(log.getLastGeneration(), 24);
+
+    std::vector<CellState> cells;
+    for (long long g = 0; g <= 24; ++g) {
+        ASSERT_TRUE(log.read(g, cells)) << "Génération " << g;
+        EXPECT_EQ(cells, states[g]) << "Génération " << g;
+    }
+    EXPECT_FALSE(log.read(25, cells));
+
+    Grid grid(3, 3);
+    grid.loadDeltaLog("Output.delta", 17);
+    EXPECT_EQ(grid.getGeneration(), 17);
+    EXPECT_EQ(cellsOf(grid), states[17]);
+    grid.loadDeltaLog("Output.delta");
+    EXPECT_EQ(grid.getGeneration(), 24);
+    EXPECT_THROW(grid.loadDeltaLog("Output.delta", 40), std::runtime_error);
+}
+
+// Un journal interrompu garde ses générations complètes
+TEST_F(DeltaLogTests, TestTruncatedTailIgnored) {
+    std::string content;
+    {
+        std::ifstream file("Output.delta", std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    // Coupé au milieu du dernier enregistrement (génération 24, image clé ou delta)
+    size_t last = content.rfind("\nD 24 ");
+    if (last == std::string::npos) {
+        last = content.rfind("\nK 24");
+    }
+    ASSERT_NE(last, std::string::npos);
+    writeFile("Truncated.delta", content.substr(0, last + 40));
+
+    DeltaLogReader log("Truncated.delta");
+    EXPECT_EQ(log.getLastGeneration(), 23);
+    std::vector<CellState> cells;
+    ASSERT_TRUE(log.read(23, cells));
+    EXPECT_EQ(cells, states[23]);
+    EXPECT_FALSE(log.read(24, cells));
+}
+
+// Fichiers invalides et deltas hors de la grille
+TEST(DeltaLogFileTests, TestInvalidLogRejected) {
+    writeFile("Invalid.delta", "1 0 0\n0 1 0\n");
+    EXPECT_THROW(DeltaLogReader log("Invalid.delta"), std::runtime_error);
+    EXPECT_THROW(DeltaLogReader log("Absent.delta"), std::runtime_error);
+
+    writeFile("Corrupt.delta", "DELTA 2 2\nK 0\n1 0\n0 0\nD 1 1\n5 0 1\n");
+    DeltaLogReader log("Corrupt.delta");
+    std::vector<CellState> cells;
+    ASSERT_TRUE(log.read(0, cells));
+    EXPECT_EQ(cells[0], VIVANT);
+    EXPECT_THROW(log.read(1, cells), std::runtime_error);
+}
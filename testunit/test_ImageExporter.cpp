@@ -0,0 +1,99 @@
+// test_ImageExporter.cpp
+#include "pch.h"
+#include "Grid.h"
+#include "ImageExporter.h"
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+std::string readFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// Composantes du pixel (x, y) d'une image PPM binaire dont l'en-tête fait headerSize octets
+unsigned char component(const std::string& ppm, size_t headerSize, int width, int x, int y, int channel) {
+    return static_cast<unsigned char>(ppm[headerSize + (static_cast<size_t>(y) * width + x) * 3 + channel]);
+}
+
+} // namespace
+
+// Une génération sur N est exportée, un pixel par cellule : vivante en blanc, obstacle en rouge
+TEST(ImageExporterTests, TestExportEveryNthGeneration) {
+    Grid grid(6, 8);
+    grid.toggleCell(2, 1, 1, VIVANT);
+    grid.toggleCell(5, 4, 1, OBSTACLE);
+
+    ImageExporter exporter("Export", ImageExporter::PPM, 3, 0, 2);
+    EXPECT_TRUE(exporter.submit(grid.snapshot(), 0));
+    EXPECT_FALSE(exporter.submit(grid.snapshot(), 4));
+    EXPECT_TRUE(exporter.submit(grid.snapshot(), 6));
+    exporter.finish();
+
+    std::string ppm = readFile("Export_000000.ppm");
+    const std::string header = "P6\n8 6\n255\n";
+    ASSERT_EQ(ppm.size(), header.size() + 8 * 6 * 3);
+    EXPECT_EQ(ppm.compare(0, header.size(), header), 0);
+    for (int channel = 0; channel < 3; ++channel) {
+        EXPECT_EQ(component(ppm, header.size(), 8, 2, 1, channel), 255);
+        EXPECT_EQ(component(ppm, header.size(), 8, 0, 0, channel), 0);
+    }
+    EXPECT_EQ(component(ppm, header.size(), 8, 5, 4, 0), 255);
+    EXPECT_EQ(component(ppm, header.size(), 8, 5, 4, 1), 0);
+
+    EXPECT_FALSE(readFile("Export_000006.ppm").empty());
+    EXPECT_TRUE(readFile("Export_000004.ppm").empty());
+}
+
+// Une grande grille est réduite par moyenne de densité
+TEST(ImageExporterTests, TestScaleDownAveragesDensity) {
+    Grid grid(10, 10);
+    grid.toggleCell(0, 0, 1, VIVANT);
+    grid.toggleCell(1, 0, 1, VIVANT);
+    grid.toggleCell(9, 9, 1, OBSTACLE);
+
+    ImageExporter exporter("Reduced", ImageExporter::PPM, 1, 5, 1);
+    EXPECT_EQ(exporter.scaleFor(10, 10), 2);
+    EXPECT_EQ(exporter.scaleFor(4, 5), 1);
+    EXPECT_EQ(exporter.scaleFor(11, 3), 3);
+    exporter.submit(grid.snapshot(), 0);
+    exporter.finish();
+
+    std::string ppm = readFile("Reduced_000000.ppm");
+    const std::string header = "P6\n5 5\n255\n";
+    ASSERT_EQ(ppm.size(), header.size() + 5 * 5 * 3);
+    EXPECT_EQ(ppm.compare(0, header.size(), header), 0);
+    // Deux cellules vivantes sur quatre : gris moyen
+    EXPECT_EQ(component(ppm, header.size(), 5, 0, 0, 0), 128);
+    EXPECT_EQ(component(ppm, header.size(), 5, 0, 0, 1), 128);
+    // Un obstacle sur quatre : rouge sombre
+    EXPECT_EQ(component(ppm, header.size(), 5, 4, 4, 0), 64);
+    EXPECT_EQ(component(ppm, header.size(), 5, 4, 4, 1), 0);
+}
+
+// Les images PNG commencent par la signature et l'en-tête attendus
+TEST(ImageExporterTests, TestPngHeader) {
+    Grid grid(7, 9);
+    grid.toggleCell(3, 3, 1, VIVANT);
+    ImageExporter exporter("Image", ImageExporter::PNG);
+    exporter.submit(grid.snapshot(), 12);
+    exporter.finish();
+
+    std::string png = readFile("Image_000012.png");
+    ASSERT_GT(png.size(), 24u);
+    EXPECT_EQ(png.compare(0, 8, "\x89PNG\r\n\x1A\n"), 0);
+    EXPECT_EQ(png.compare(12, 4, "IHDR"), 0);
+    EXPECT_EQ(static_cast<unsigned char>(png[19]), 9);
+    EXPECT_EQ(static_cast<unsigned char>(png[23]), 7);
+}
+
+// Une image impossible à écrire est signalée par finish()
+TEST(ImageExporterTests, TestWriteFailureReported) {
+    Grid grid(4, 4);
+    ImageExporter exporter("DossierAbsent/Image", ImageExporter::PPM);
+    exporter.submit(grid.snapshot(), 0);
+    EXPECT_THROW(exporter.finish(), std::runtime_error);
+}
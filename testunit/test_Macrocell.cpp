@@ -0,0 +1,160 @@
+// test_Macrocell.cpp
+#include "pch.h"
+#include "Grid.h"
+#include "Macrocell.h"
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+// Planeur Golly : une feuille 8 x 8 placée dans le quart sud-est d'un nœud de niveau 4
+const char GLIDER[] = "[M2] (golly 4.2)\n#R B3/S23\n.*$..*$***$\n4 0 0 0 1\n";
+
+Quadtree parse(const std::string& text, Rule& rule) {
+    return Macrocell::parse(text.data(), text.size(), rule);
+}
+
+Quadtree parse(const std::string& text) {
+    Rule rule;
+    return parse(text, rule);
+}
+
+void writeFile(const char* filename, const std::string& content) {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+// Enregistre une soupe aléatoire puis vérifie que le rectangle englobant est relu à l'identique
+void expectRoundTrip(bool withObstacles) {
+    const int rows = 77;
+    const int cols = 131;
+    Grid grid(rows, cols);
+    Pattern pattern;
+    pattern.alive = BitPlane(rows, cols);
+    pattern.obstacles = BitPlane(rows, cols);
+    pattern.rule = Rule::parse("B36/S23");
+    std::mt19937 random(withObstacles ? 9 : 10);
+    for (int i = 3; i < rows - 5; ++i) {
+        for (int j = 2; j < cols - 7; ++j) {
+            unsigned draw = random() % 100;
+            if (withObstacles && draw < 4) pattern.obstacles.set(i, j);
+            else if (draw < 25) pattern.alive.set(i, j);
+        }
+    }
+    grid.loadPattern(pattern);
+    grid.saveMacrocell("Pattern.mc");
+
+    int top = rows;
+    int left = cols;
+    int bottom = -1;
+    int right = -1;
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            if (grid.getCellState(i, j) == VIVANT || grid.getCellState(i, j) == OBSTACLE) {
+                top = std::min(top, i);
+                bottom = std::max(bottom, i);
+                left = std::min(left, j);
+                right = std::max(right, j);
+            }
+        }
+    }
+
+    Grid loaded(3, 3);
+    loaded.initializeFromMacrocell("Pattern.mc");
+    EXPECT_EQ(loaded.getRule(), grid.getRule());
+    ASSERT_EQ(loaded.getRows(), bottom - top + 1);
+    ASSERT_EQ(loaded.getCols(), right - left + 1);
+    for (int i = top; i <= bottom; ++i) {
+        for (int j = left; j <= right; ++j) {
+            CellState state = grid.getCellState(i, j);
+            if (state == MORT) state = VIDE;
+            ASSERT_EQ(loaded.getCellState(i - top, j - left), state) << "Cellule (" << i << ", " << j << ")";
+        }
+    }
+}
+
+} // namespace
+
+// Enregistrer puis recharger redonne les cellules vivantes et la règle
+TEST(MacrocellTests, TestRoundTrip) {
+    expectRoundTrip(false);
+}
+
+// Les obstacles passent par la variante multi-états
+TEST(MacrocellTests, TestRoundTripWithObstacles) {
+    expectRoundTrip(true);
+}
+
+// Lecture d'un fichier produit par Golly
+TEST(MacrocellTests, TestParseGollyGlider) {
+    Rule rule = Rule::parse("B36/S23");
+    Quadtree tree = parse(GLIDER, rule);
+    EXPECT_EQ(rule, Rule());
+    EXPECT_EQ(tree.getLevel(), 4);
+    EXPECT_EQ(tree.get(8, 9), VIVANT);
+    EXPECT_EQ(tree.get(9, 10), VIVANT);
+    EXPECT_EQ(tree.get(10, 8), VIVANT);
+    EXPECT_EQ(tree.get(8, 8), VIDE);
+    EXPECT_EQ(tree.get(0, 0), VIDE);
+
+    writeFile("Glider.mc", GLIDER);
+    Grid grid(3, 3);
+    grid.initializeFromMacrocell("Glider.mc");
+    EXPECT_EQ(grid.getRows(), 3);
+    EXPECT_EQ(grid.getCols(), 3);
+    EXPECT_EQ(grid.getCellState(0, 1), VIVANT);
+    EXPECT_EQ(grid.getCellState(1, 2), VIVANT);
+    EXPECT_EQ(grid.getCellState(2, 0), VIVANT);
+    EXPECT_EQ(grid.getCellState(0, 0), VIDE);
+}
+
+// Un motif immense mais répétitif reste compact en mémoire et ne peut pas être mis à plat
+TEST(MacrocellTests, TestHugePatternStaysCompact) {
+    std::string text = "[M2]\n#R B3/S23\n.*$..*$***$\n4 1 1 1 1\n";
+    for (int k = 5; k <= 30; ++k) {
+        text += std::to_string(k) + " " + std::to_string(k - 3) + " 0 0 " + std::to_string(k - 3) + "\n";
+    }
+    Rule rule;
+    Quadtree tree = parse(text, rule);
+    EXPECT_EQ(tree.getLevel(), 30);
+    long long top = 0;
+    long long left = 0;
+    long long bottom = 0;
+    long long right = 0;
+    ASSERT_TRUE(tree.bounds(top, left, bottom, right));
+    EXPECT_EQ(top, 0);
+    EXPECT_EQ(left, 0);
+    EXPECT_EQ(tree.get((1LL << 30) - 6, (1LL << 30) - 8), VIVANT);
+
+    // Réécrire l'arbre ne duplique aucun nœud partagé
+    std::ostringstream out;
+    Macrocell::write(out, tree, rule);
+    Quadtree reread = parse(out.str());
+    EXPECT_EQ(reread.getNodeCount(), tree.getNodeCount());
+
+    writeFile("Huge.mc", text);
+    Grid grid(3, 3);
+    EXPECT_THROW(grid.initializeFromMacrocell("Huge.mc"), std::runtime_error);
+    EXPECT_EQ(grid.getRows(), 3);
+}
+
+// Un contenu invalide ou tronqué est refusé
+TEST(MacrocellTests, TestInvalidInputRejected) {
+    EXPECT_THROW(parse(""), std::runtime_error);
+    EXPECT_THROW(parse(".*$..*$***$\n4 0 0 0 1\n"), std::runtime_error);
+    EXPECT_THROW(parse("[M2]\n.*$..*$***$\n4 0 0 0\n"), std::runtime_error);
+    EXPECT_THROW(parse("[M2]\n.*$..*$***$\n4 0 0 x 1\n"), std::runtime_error);
+    EXPECT_THROW(parse("[M2]\n.*$..*$*o*$\n"), std::runtime_error);
+    EXPECT_THROW(parse("[M2]\n.*$..*$***$\n4 0 0 0 2\n"), std::runtime_error);
+    EXPECT_THROW(parse("[M2]\n.*$..*$***$\n5 0 0 0 1\n"), std::runtime_error);
+    EXPECT_THROW(parse("[M2]\n1 0 3 0 0\n"), std::runtime_error);
+    EXPECT_THROW(parse("[M2]\n99 0 0 0 0\n"), std::runtime_error);
+    EXPECT_THROW(parse("[M2]\n#R B9/S23\n"), std::runtime_error);
+
+    Rule rule;
+    EXPECT_THROW(Macrocell::read("Absent.mc", rule), std::runtime_error);
+}
@@ -0,0 +1,132 @@
+// test_RLE.cpp
+#include "pch.h"
+#include "Grid.h"
+#include "RLE.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+// Canon à planeurs de Gosper (36 x 9)
+const char GOSPER_GUN[] =
+    "#N Gosper glider gun\n"
+    "x = 36, y = 9, rule = B3/S23\n"
+    "24bo$22bobo$12b2o6b2o12b2o$11bo3bo4b2o12b2o$2o8bo5bo3b2o$2o8bo3bob2o4b\n"
+    "obo$10bo5bo7bo$11bo3bo$12b2o!\n";
+
+Pattern parse(const std::string& text) {
+    return RLE::parse(text.data(), text.size());
+}
+
+void expectSamePlane(const BitPlane& expected, const BitPlane& actual) {
+    ASSERT_EQ(expected.getRows(), actual.getRows());
+    ASSERT_EQ(expected.getCols(), actual.getCols());
+    for (int i = 0; i < expected.getRows(); ++i) {
+        for (int j = 0; j < expected.getCols(); ++j) {
+            ASSERT_EQ(expected.get(i, j), actual.get(i, j)) << "Cellule (" << i << ", " << j << ")";
+        }
+    }
+}
+
+} // namespace
+
+// Lecture de l'en-tête et des suites d'un motif connu
+TEST(RLETests, TestParseGosperGun) {
+    Pattern pattern = parse(GOSPER_GUN);
+    EXPECT_EQ(pattern.alive.getCols(), 36);
+    EXPECT_EQ(pattern.alive.getRows(), 9);
+    EXPECT_EQ(pattern.rule, Rule());
+
+    int population = 0;
+    for (int i = 0; i < 9; ++i) {
+        for (int j = 0; j < 36; ++j) {
+            population += pattern.alive.get(i, j) ? 1 : 0;
+        }
+    }
+    EXPECT_EQ(population, 36);
+    EXPECT_TRUE(pattern.alive.get(0, 24));
+    EXPECT_TRUE(pattern.alive.get(4, 0));
+    EXPECT_TRUE(pattern.alive.get(8, 13));
+    EXPECT_FALSE(pattern.obstacles.any());
+}
+
+// Écrire puis relire redonne le même motif, obstacles et règle compris
+TEST(RLETests, TestRoundTrip) {
+    Pattern pattern = parse(GOSPER_GUN);
+    pattern.obstacles.set(0, 0);
+    pattern.obstacles.setRun(7, 20, 10);
+    pattern.rule = Rule::parse("B36/S23");
+
+    std::ostringstream out;
+    RLE::write(out, pattern);
+    Pattern read = parse(out.str());
+
+    expectSamePlane(pattern.alive, read.alive);
+    expectSamePlane(pattern.obstacles, read.obstacles);
+    EXPECT_EQ(read.rule, pattern.rule);
+
+    // Aucune ligne ne dépasse 70 caractères
+    std::istringstream lines(out.str());
+    std::string line;
+    while (std::getline(lines, line)) {
+        EXPECT_LE(line.size(), 70u);
+    }
+}
+
+// Un motif chargé dans une grille plus grande est centré et la règle de l'en-tête est adoptée
+TEST(RLETests, TestLoadIntoGrid) {
+    {
+        std::ofstream file("Pattern.rle");
+        file << "x = 3, y = 1, rule = B36/S23\n3o!\n";
+    }
+    Grid grid(11, 11);
+    grid.initializeFromRLE("Pattern.rle");
+    EXPECT_EQ(grid.getRule(), Rule::parse("B36/S23"));
+    EXPECT_EQ(grid.getCellState(5, 4), VIVANT);
+    EXPECT_EQ(grid.getCellState(5, 5), VIVANT);
+    EXPECT_EQ(grid.getCellState(5, 6), VIVANT);
+    EXPECT_EQ(grid.getCellState(5, 3), VIDE);
+    EXPECT_EQ(grid.getCellState(4, 5), VIDE);
+
+    grid.saveRLE("Saved.rle");
+    Pattern saved = RLE::read("Saved.rle");
+    EXPECT_EQ(saved.alive.getRows(), 11);
+    EXPECT_TRUE(saved.alive.get(5, 4));
+    EXPECT_FALSE(saved.alive.get(5, 3));
+}
+
+// Un contenu invalide est refusé
+TEST(RLETests, TestInvalidInputRejected) {
+    EXPECT_THROW(parse(""), std::runtime_error);
+    EXPECT_THROW(parse("#C commentaire seul\n"), std::runtime_error);
+    EXPECT_THROW(parse("3o!"), std::runtime_error);
+    EXPECT_THROW(parse("x = 3a, y = 1\n3o!"), std::runtime_error);
+    EXPECT_THROW(parse("x = 3, y = 1, rule = B9/S23\n3o!"), std::runtime_error);
+    EXPECT_THROW(RLE::read("Absent.rle"), std::runtime_error);
+}
+
+// Un motif coupé avant « ! » garde les suites déjà lues ; les suites trop longues sont rognées
+TEST(RLETests, TestTruncatedBodyClipped) {
+    Pattern pattern = parse("x = 4, y = 2\n2o$10o");
+    EXPECT_TRUE(pattern.alive.get(0, 0));
+    EXPECT_TRUE(pattern.alive.get(0, 1));
+    EXPECT_FALSE(pattern.alive.get(0, 2));
+    for (int j = 0; j < 4; ++j) {
+        EXPECT_TRUE(pattern.alive.get(1, j));
+    }
+}
+
+// Des dimensions démesurées sont refusées avant toute allocation
+TEST(RLETests, TestOversizedHeaderRejected) {
+    EXPECT_THROW(parse("x = 99999999999999999999999999, y = 1\no!"), std::runtime_error);
+    EXPECT_THROW(parse("x = 4294967297, y = 4294967297\no!"), std::runtime_error);
+    EXPECT_THROW(parse("x = 100000, y = 100000\no!"), std::runtime_error);
+    EXPECT_THROW(parse("x = 0, y = 300000000\n!"), std::runtime_error);
+
+    // Une longueur de suite démesurée est seulement rognée
+    Pattern pattern = parse("x = 3, y = 1\n99999999999999999999999999999b3o!");
+    EXPECT_EQ(pattern.alive.getCols(), 3);
+    EXPECT_FALSE(pattern.alive.any());
+}
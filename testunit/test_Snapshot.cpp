@@ -0,0 +1,125 @@
+// test_Snapshot.cpp
+#include "pch.h"
+#include "Grid.h"
+#include "Snapshot.h"
+#include <vector>
+
+namespace {
+
+// Place une cellule vivante (toggleCell prend des coordonnées en pixels : colonne, puis ligne)
+void setAlive(Grid& grid, int row, int col) {
+    grid.toggleCell(col, row, 1, VIVANT);
+}
+
+// Planeur dans le coin supérieur gauche et clignotant à l'écart
+void addGliderAndBlinker(Grid& grid) {
+    setAlive(grid, 0, 1);
+    setAlive(grid, 1, 2);
+    setAlive(grid, 2, 0);
+    setAlive(grid, 2, 1);
+    setAlive(grid, 2, 2);
+    setAlive(grid, 140, 100);
+    setAlive(grid, 141, 100);
+    setAlive(grid, 142, 100);
+}
+
+void expectSameCells(const Grid& expected, const Grid& actual) {
+    ASSERT_EQ(expected.getRows(), actual.getRows());
+    ASSERT_EQ(expected.getCols(), actual.getCols());
+    for (int i = 0; i < expected.getRows(); ++i) {
+        for (int j = 0; j < expected.getCols(); ++j) {
+            ASSERT_EQ(expected.getCellState(i, j), actual.getCellState(i, j)) << "Cellule (" << i << ", " << j << ")";
+        }
+    }
+}
+
+} // namespace
+
+// Les tuiles inchangées d'une génération à l'autre sont partagées, les tuiles vides ne sont pas allouées
+TEST(SnapshotTests, TestUnchangedTilesShared) {
+    Grid grid(192, 192);
+    // Bloc (stable) dans la tuile (0, 0), clignotant dans la tuile (2, 2)
+    setAlive(grid, 10, 10);
+    setAlive(grid, 10, 11);
+    setAlive(grid, 11, 10);
+    setAlive(grid, 11, 11);
+    setAlive(grid, 150, 149);
+    setAlive(grid, 150, 150);
+    setAlive(grid, 150, 151);
+
+    GridSnapshot before = grid.snapshot();
+    grid.update();
+    GridSnapshot after = grid.snapshot();
+
+    EXPECT_EQ(before.getTile(0, 0), after.getTile(0, 0)) << "Le bloc n'a pas changé : sa tuile doit être partagée";
+    EXPECT_NE(before.getTile(2, 2), after.getTile(2, 2)) << "Le clignotant a changé : sa tuile doit être recapturée";
+    EXPECT_EQ(after.getTile(1, 1), GridSnapshot::emptyTile());
+
+    std::vector<int> changed;
+    after.changedTiles(before, changed);
+    ASSERT_EQ(changed.size(), 1u);
+    EXPECT_EQ(changed[0], 2 * after.getTileCols() + 2);
+}
+
+// Annuler plusieurs générations redonne exactement les états précédents
+TEST(SnapshotTests, TestUndoRestoresEarlierGenerations) {
+    Grid grid(200, 150);
+    addGliderAndBlinker(grid);
+
+    std::vector<std::uint64_t> hashes;
+    for (int k = 0; k < 30; ++k) {
+        hashes.push_back(grid.hash());
+        grid.update();
+    }
+    EXPECT_EQ(grid.getGeneration(), 30);
+
+    for (int k = 29; k >= 0; --k) {
+        grid.undo();
+        EXPECT_EQ(grid.getGeneration(), k);
+        EXPECT_EQ(grid.hash(), hashes[k]) << "Génération " << k;
+    }
+}
+
+// Une copie obtenue par fork évolue indépendamment de l'original
+TEST(SnapshotTests, TestForkIsIndependent) {
+    Grid grid(200, 150);
+    addGliderAndBlinker(grid);
+    for (int k = 0; k < 10; ++k) {
+        grid.update();
+    }
+
+    Grid copy = grid.fork();
+    Grid reference(grid.snapshot());
+    for (int k = 0; k < 15; ++k) {
+        grid.update();
+    }
+    expectSameCells(reference, copy);
+    EXPECT_EQ(copy.getGeneration(), 10);
+
+    for (int k = 0; k < 15; ++k) {
+        copy.update();
+    }
+    expectSameCells(grid, copy);
+
+    // L'historique de la copie est le sien : l'annulation ne touche pas l'original
+    copy.undo();
+    EXPECT_EQ(copy.getGeneration(), 24);
+    EXPECT_EQ(grid.getGeneration(), 25);
+}
+
+// Restaurer un instantané puis annuler revient à l'état d'avant la restauration
+TEST(SnapshotTests, TestRestoreThenUndo) {
+    Grid grid(200, 150);
+    addGliderAndBlinker(grid);
+    std::uint64_t initial = grid.hash();
+
+    Grid other = grid.fork();
+    for (int k = 0; k < 20; ++k) {
+        other.update();
+    }
+    grid.restore(other.snapshot());
+    EXPECT_EQ(grid.hash(), other.hash());
+
+    grid.undo();
+    EXPECT_EQ(grid.hash(), initial);
+}
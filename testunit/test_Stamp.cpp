@@ -0,0 +1,197 @@
+// test_Stamp.cpp
+#include "pch.h"
+#include "Grid.h"
+#include "BrushStroke.h"
+#include "PatternPalette.h"
+#include <random>
+#include <vector>
+
+namespace {
+
+// État affiché d'une cellule (MORT et VIDE sont équivalents pour un motif)
+CellState stateAt(const Grid& grid, int row, int col) {
+    CellState state = grid.getCellState(row, col);
+    return state == MORT ? VIDE : state;
+}
+
+int population(const Grid& grid) {
+    int alive = 0;
+    for (int i = 0; i < grid.getRows(); ++i) {
+        for (int j = 0; j < grid.getCols(); ++j) {
+            alive += grid.getCellState(i, j) == VIVANT ? 1 : 0;
+        }
+    }
+    return alive;
+}
+
+// Applique state à une cellule de la référence, avec la même priorité que la grille
+void apply(std::vector<CellState>& cells, int cols, int row, int col, CellState state) {
+    CellState& cell = cells[static_cast<size_t>(row) * cols + col];
+    if (state == OBSTACLE || cell != OBSTACLE) {
+        cell = state;
+    }
+}
+
+} // namespace
+
+// Le motif appliqué cellule par cellule et par plages de bits donnent le même résultat, torique ou non
+TEST(StampTests, TestMatchesCellByCell) {
+    std::mt19937 random(5);
+    for (int iteration = 0; iteration < 120; ++iteration) {
+        int rows = 1 + static_cast<int>(random() % 150);
+        int cols = 1 + static_cast<int>(random() % 150);
+        bool toric = random() % 2 == 0;
+        Grid grid(rows, cols);
+        grid.setToric(toric);
+        std::vector<CellState> expected(static_cast<size_t>(rows) * cols, VIDE);
+        for (int k = 0; k < rows * cols / 5; ++k) {
+            int row = static_cast<int>(random() % rows);
+            int col = static_cast<int>(random() % cols);
+            CellState state = static_cast<CellState>(random() % 3);
+            grid.toggleCell(col, row, 1, state);
+            apply(expected, cols, row, col, state);
+        }
+
+        int height = 1 + static_cast<int>(random() % 100);
+        int width = 1 + static_cast<int>(random() % 200);
+        BitPlane shape(height, width);
+        unsigned density = random() % 4;
+        for (int i = 0; i < height; ++i) {
+            for (int j = 0; j < width; ++j) {
+                if (density == 3 || random() % 4 < density) shape.set(i, j);
+            }
+        }
+        int top = static_cast<int>(random() % (rows + 60)) - 30 - height / 2;
+        int left = static_cast<int>(random() % (cols + 60)) - 30 - width / 2;
+        CellState state = static_cast<CellState>(random() % 3);
+        grid.stamp(shape, top, left, state);
+
+        for (int i = 0; i < height; ++i) {
+            for (int j = 0; j < width; ++j) {
+                if (!shape.get(i, j)) continue;
+                int row = top + i;
+                int col = left + j;
+                if (toric) {
+                    row = ((row % rows) + rows) % rows;
+                    col = ((col % cols) + cols) % cols;
+                }
+                else if (row < 0 || row >= rows || col < 0 || col >= cols) {
+                    continue;
+                }
+                apply(expected, cols, row, col, state);
+            }
+        }
+        for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < cols; ++j) {
+                ASSERT_EQ(stateAt(grid, i, j), expected[static_cast<size_t>(i) * cols + j])
+                    << "Itération " << iteration << ", cellule (" << i << ", " << j << ")";
+            }
+        }
+    }
+}
+
+// Un motif qui déborde d'un coin est replié sur les quatre coins d'une grille torique, coupé sinon
+TEST(StampTests, TestCornerWrapsOnToricGrid) {
+    BitPlane square(3, 3);
+    for (int i = 0; i < 3; ++i) {
+        square.setRun(i, 0, 3);
+    }
+
+    Grid toric(20, 70);
+    toric.setToric(true);
+    toric.stamp(square, -1, -1, VIVANT);
+    EXPECT_EQ(population(toric), 9);
+    for (int row : { 19, 0, 1 }) {
+        for (int col : { 69, 0, 1 }) {
+            EXPECT_EQ(toric.getCellState(row, col), VIVANT) << "Cellule (" << row << ", " << col << ")";
+        }
+    }
+
+    Grid bounded(20, 70);
+    bounded.stamp(square, -1, -1, VIVANT);
+    EXPECT_EQ(population(bounded), 4);
+    EXPECT_EQ(bounded.getCellState(1, 1), VIVANT);
+    EXPECT_EQ(stateAt(bounded, 19, 69), VIDE);
+
+    // Plage de bits à cheval sur le bord droit
+    BitPlane line(1, 100);
+    line.setRun(0, 0, 100);
+    toric.stamp(line, 10, 40, VIVANT);
+    for (int col = 0; col < 70; ++col) {
+        EXPECT_EQ(toric.getCellState(10, col), VIVANT) << "Colonne " << col;
+    }
+}
+
+// Une construction de la palette se comporte comme le motif d'origine et les obstacles sont préservés
+TEST(StampTests, TestPaletteConstruction) {
+    Grid blocked(60, 60);
+    blocked.toggleCell(34, 10, 1, OBSTACLE);
+    blocked.stamp(PatternPalette::pattern(PatternPalette::CANON_GOSPER), 10, 10, VIVANT);
+    EXPECT_EQ(blocked.getCellState(10, 34), OBSTACLE);
+    EXPECT_EQ(population(blocked), 35);
+
+    Grid grid(60, 60);
+    grid.stamp(PatternPalette::pattern(PatternPalette::CANON_GOSPER), 10, 10, VIVANT);
+    EXPECT_EQ(population(grid), 36);
+    for (int k = 0; k < 30; ++k) {
+        grid.update();
+    }
+    // Le canon a émis un planeur de 5 cellules
+    EXPECT_EQ(population(grid), 36 + 5);
+
+    for (int m = 0; m < PatternPalette::MOTIFS; ++m) {
+        EXPECT_TRUE(PatternPalette::pattern(static_cast<PatternPalette::Motif>(m)).any()) << PatternPalette::name(static_cast<PatternPalette::Motif>(m));
+    }
+    BitPlane brush = PatternPalette::brush(3);
+    EXPECT_EQ(brush.getRows(), 7);
+    EXPECT_TRUE(brush.get(3, 0));
+    EXPECT_TRUE(brush.get(0, 3));
+    EXPECT_FALSE(brush.get(0, 0));
+}
+
+// Un tracé au pinceau reste continu entre deux positions et reprend depuis la dernière
+TEST(StampTests, TestBrushStrokeIsContinuous) {
+    BrushStroke stroke;
+    BitPlane plane;
+    int top = -99;
+    int left = -99;
+    EXPECT_FALSE(stroke.take(PatternPalette::brush(0), plane, top, left));
+    EXPECT_EQ(top, -99);
+
+    stroke.add(5, 5);
+    stroke.add(5, 15);
+    stroke.add(15, 15);
+    ASSERT_TRUE(stroke.take(PatternPalette::brush(1), plane, top, left));
+    EXPECT_TRUE(stroke.empty());
+    EXPECT_EQ(top, 4);
+    EXPECT_EQ(left, 4);
+    EXPECT_EQ(plane.getRows(), 13);
+    EXPECT_EQ(plane.getCols(), 13);
+    for (int col = 5; col <= 15; ++col) {
+        EXPECT_TRUE(plane.get(5 - top, col - left));
+    }
+    for (int row = 5; row <= 15; ++row) {
+        EXPECT_TRUE(plane.get(row - top, 15 - left));
+    }
+    EXPECT_FALSE(plane.get(14 - top, 5 - left));
+
+    // Le tracé continue depuis (15, 15) sans la redessiner
+    stroke.add(15, 20);
+    ASSERT_TRUE(stroke.take(PatternPalette::brush(0), plane, top, left));
+    EXPECT_EQ(left, 16);
+    EXPECT_EQ(plane.getCols(), 5);
+
+    // Après end(), la position suivante commence un nouveau segment
+    stroke.end();
+    stroke.add(0, 0);
+    ASSERT_TRUE(stroke.take(PatternPalette::brush(0), plane, top, left));
+    EXPECT_EQ(plane.getCols(), 1);
+
+    Grid grid(30, 30);
+    stroke.end();
+    stroke.add(2, 2);
+    stroke.add(2, 8);
+    ASSERT_TRUE(stroke.take(PatternPalette::brush(0), plane, top, left));
+    grid.stamp(plane, top, left, VIVANT);
+    EXPECT_EQ(population(grid), 7);
+}
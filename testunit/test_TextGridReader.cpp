@@ -0,0 +1,91 @@
+// test_TextGridReader.cpp
+#include "pch.h"
+#include "Grid.h"
+#include "TextGridReader.h"
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+// Une grande grille lue en parallèle donne les mêmes cellules qu'une lecture jeton par jeton
+TEST(TextGridReaderTests, TestParallelMatchesExpected) {
+    const int rows = 300;
+    const int cols = 257;
+    std::vector<CellState> expected;
+    std::mt19937 random(7);
+    {
+        std::ofstream file("Large.txt", std::ios::binary);
+        for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < cols; ++j) {
+                unsigned draw = random() % 10;
+                // Jetons et séparateurs variés : « X » et « x » sont des obstacles, tout autre jeton est VIDE
+                const char* token = draw < 3 ? "1" : draw == 3 ? "X" : draw == 4 ? "x" : draw == 5 ? "2" : "0";
+                expected.push_back(draw < 3 ? VIVANT : draw == 3 || draw == 4 ? OBSTACLE : VIDE);
+                file << token << (draw % 2 ? "  " : "\t");
+            }
+            file << (i % 2 ? "\r\n" : "\n");
+        }
+    }
+
+    TextGridReader reader("Large.txt");
+    int fileRows = 0;
+    int fileCols = 0;
+    reader.dimensions(fileRows, fileCols);
+    EXPECT_EQ(fileRows, rows);
+    EXPECT_EQ(fileCols, cols);
+
+    for (unsigned threads : { 1u, 3u, 8u }) {
+        std::vector<CellState> cells(expected.size(), VIDE);
+        reader.read(cells.data(), cells.size(), threads);
+        EXPECT_EQ(cells, expected) << threads << " threads";
+    }
+}
+
+// Les dimensions s'arrêtent au premier séparateur d'un fichier de sortie
+TEST(TextGridReaderTests, TestDimensionsStopAtSeparator) {
+    {
+        std::ofstream file("Output.txt");
+        file << "\n1 0 X\n0 1 0\n-----------------------\n1 1 1\n0 0 0\n";
+    }
+    TextGridReader reader("Output.txt");
+    int rows = 0;
+    int cols = 0;
+    reader.dimensions(rows, cols);
+    EXPECT_EQ(rows, 2);
+    EXPECT_EQ(cols, 3);
+
+    Grid grid(5, 5);
+    grid.loadFromInput("Output.txt");
+    EXPECT_EQ(grid.getRows(), 2);
+    EXPECT_EQ(grid.getCols(), 3);
+    EXPECT_EQ(grid.getCellState(0, 0), VIVANT);
+    EXPECT_EQ(grid.getCellState(0, 2), OBSTACLE);
+    EXPECT_EQ(grid.getCellState(1, 1), VIVANT);
+}
+
+// Un fichier trop court laisse les cellules restantes VIDE
+TEST(TextGridReaderTests, TestShortFileLeavesCellsEmpty) {
+    {
+        std::ofstream file("Short.txt");
+        file << "1 1\n1";
+    }
+    Grid grid(3, 3);
+    grid.initializeFromInput("Short.txt");
+    EXPECT_EQ(grid.getCellState(0, 0), VIVANT);
+    EXPECT_EQ(grid.getCellState(0, 1), VIVANT);
+    EXPECT_EQ(grid.getCellState(0, 2), VIVANT);
+    for (int i = 1; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            EXPECT_EQ(grid.getCellState(i, j), VIDE);
+        }
+    }
+}
+
+// Fichier absent ou sans cellule
+TEST(TextGridReaderTests, TestMissingOrEmptyFileRejected) {
+    EXPECT_THROW(TextGridReader reader("Absent.txt"), std::runtime_error);
+
+    { std::ofstream file("Empty.txt"); }
+    Grid grid(3, 3);
+    EXPECT_THROW(grid.loadFromInput("Empty.txt"), std::runtime_error);
+}
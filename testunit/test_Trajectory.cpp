@@ -0,0 +1,158 @@
+// test_Trajectory.cpp
+#include "pch.h"
+#include "Grid.h"
+#include "Trajectory.h"
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char TRAJECTORY_FILE[] = "Trajectory.golt";
+
+std::vector<CellState> cellsOf(const Grid& grid) {
+    std::vector<CellState> cells;
+    for (int i = 0; i < grid.getRows(); ++i) {
+        for (int j = 0; j < grid.getCols(); ++j) {
+            cells.push_back(grid.getCellState(i, j));
+        }
+    }
+    return cells;
+}
+
+long long fileSize(const char* filename) {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    return static_cast<long long>(file.tellg());
+}
+
+// Planeur et obstacle (toggleCell prend des coordonnées en pixels : colonne, puis ligne)
+void addGlider(Grid& grid) {
+    grid.toggleCell(1, 0, 1, VIVANT);
+    grid.toggleCell(2, 1, 1, VIVANT);
+    grid.toggleCell(0, 2, 1, VIVANT);
+    grid.toggleCell(1, 2, 1, VIVANT);
+    grid.toggleCell(2, 2, 1, VIVANT);
+    grid.toggleCell(30, 30, 1, OBSTACLE);
+}
+
+} // namespace
+
+// Classe de test : 100 générations enregistrées avec une image clé toutes les 8 générations
+class TrajectoryTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        grid = new Grid(50, 70);
+        addGlider(*grid);
+        states.push_back(cellsOf(*grid));
+        grid->recordTrajectory(TRAJECTORY_FILE, 8);
+        for (int k = 0; k < 100; ++k) {
+            grid->update();
+            states.push_back(cellsOf(*grid));
+        }
+    }
+
+    void TearDown() override {
+        delete grid;
+    }
+
+    Grid* grid;
+    std::vector<std::vector<CellState>> states; // États attendus, par génération
+};
+
+// Chaque génération relue dans le fichier est identique à celle qui a été calculée
+TEST_F(TrajectoryTests, TestRoundTrip) {
+    Trajectory trajectory(TRAJECTORY_FILE);
+    EXPECT_EQ(trajectory.getRows(), 50);
+    EXPECT_EQ(trajectory.getCols(), 70);
+    EXPECT_EQ(trajectory.getFirstGeneration(), 0);
+    EXPECT_EQ(trajectory.getLastGeneration(), 100);
+
+    std::vector<CellState> cells;
+    for (long long g = 0; g <= 100; ++g) {
+        ASSERT_TRUE(trajectory.read(g, cells)) << "Génération " << g;
+        EXPECT_EQ(cells, states[g]) << "Génération " << g;
+    }
+    EXPECT_FALSE(trajectory.read(101, cells));
+
+    Grid resumed(1, 1);
+    resumed.resumeTrajectory(TRAJECTORY_FILE);
+    EXPECT_EQ(resumed.getGeneration(), 100);
+    EXPECT_EQ(cellsOf(resumed), states[100]);
+}
+
+// Annulation et parcours au-delà de plusieurs images clés
+TEST_F(TrajectoryTests, TestUndoAndSeekAcrossKeyframes) {
+    for (int k = 0; k < 30; ++k) {
+        grid->undo();
+    }
+    EXPECT_EQ(grid->getGeneration(), 70);
+    EXPECT_EQ(cellsOf(*grid), states[70]);
+
+    for (long long g : { 13, 8, 7, 0, 99, 64, 65 }) {
+        ASSERT_TRUE(grid->seekGeneration(g)) << "Génération " << g;
+        EXPECT_EQ(cellsOf(*grid), states[g]) << "Génération " << g;
+    }
+    EXPECT_FALSE(grid->seekGeneration(101));
+}
+
+// Reprendre après un retour en arrière remplace les générations suivantes et raccourcit le fichier
+TEST_F(TrajectoryTests, TestRewriteAfterSeekTruncatesFile) {
+    long long before = fileSize(TRAJECTORY_FILE);
+    ASSERT_TRUE(grid->seekGeneration(5));
+    grid->update();
+    EXPECT_LT(fileSize(TRAJECTORY_FILE), before);
+
+    Trajectory trajectory(TRAJECTORY_FILE);
+    EXPECT_EQ(trajectory.getLastGeneration(), 6);
+    std::vector<CellState> cells;
+    for (long long g = 0; g <= 6; ++g) {
+        ASSERT_TRUE(trajectory.read(g, cells));
+        EXPECT_EQ(cells, states[g]) << "Génération " << g;
+    }
+}
+
+// Un enregistrement incomplet (arrêt brutal) est ignoré et la trajectoire reprend avant lui
+TEST_F(TrajectoryTests, TestTornRecordIsDropped) {
+    delete grid;
+    grid = nullptr;
+
+    // Dernier enregistrement coupé avant sa fin
+    std::string content;
+    {
+        std::ifstream file(TRAJECTORY_FILE, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream file(TRAJECTORY_FILE, std::ios::binary | std::ios::trunc);
+        file.write(content.data(), static_cast<std::streamsize>(content.size() - 3));
+    }
+
+    Grid resumed(1, 1);
+    resumed.resumeTrajectory(TRAJECTORY_FILE);
+    EXPECT_EQ(resumed.getGeneration(), 99);
+    EXPECT_EQ(cellsOf(resumed), states[99]);
+
+    // Les générations suivantes prolongent le fichier réparé
+    resumed.update();
+    EXPECT_EQ(cellsOf(resumed), states[100]);
+    Trajectory trajectory(TRAJECTORY_FILE);
+    EXPECT_EQ(trajectory.getLastGeneration(), 100);
+    std::vector<CellState> cells;
+    ASSERT_TRUE(trajectory.read(100, cells));
+    EXPECT_EQ(cells, states[100]);
+}
+
+// Un fichier qui n'est pas une trajectoire est refusé
+TEST(TrajectoryFileTests, TestInvalidHeaderRejected) {
+    {
+        std::ofstream file("Invalid.golt", std::ios::binary);
+        file << "ceci n'est pas une trajectoire";
+    }
+    EXPECT_THROW(Trajectory trajectory("Invalid.golt"), std::runtime_error);
+
+    Grid grid(10, 10);
+    EXPECT_THROW(grid.resumeTrajectory("Invalid.golt"), std::runtime_error);
+    EXPECT_THROW(grid.resumeTrajectory("Absent.golt"), std::runtime_error);
+}
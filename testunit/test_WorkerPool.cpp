@@ -0,0 +1,96 @@
+// test_WorkerPool.cpp
+#include "pch.h"
+#include "Grid.h"
+#include "WorkerPool.h"
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// Soupe aléatoire reproductible avec obstacles
+void fillRandom(Grid& grid, unsigned seed) {
+    Pattern pattern;
+    pattern.alive = BitPlane(grid.getRows(), grid.getCols());
+    pattern.obstacles = BitPlane(grid.getRows(), grid.getCols());
+    std::mt19937 random(seed);
+    for (int i = 0; i < grid.getRows(); ++i) {
+        for (int j = 0; j < grid.getCols(); ++j) {
+            unsigned draw = random() % 100;
+            if (draw < 2) pattern.obstacles.set(i, j);
+            else if (draw < 33) pattern.alive.set(i, j);
+        }
+    }
+    grid.loadPattern(pattern);
+}
+
+} // namespace
+
+// Toutes les tâches soumises sont exécutées une fois, même avec une file d'une seule place
+TEST(WorkerPoolTests, TestEveryTaskRuns) {
+    WorkerPool pool(4, 1);
+    EXPECT_EQ(pool.getThreadCount(), 4u);
+
+    std::vector<std::atomic<int>> runs(500);
+    for (std::atomic<int>& count : runs) {
+        count = 0;
+    }
+    for (size_t k = 0; k < runs.size(); ++k) {
+        pool.submit([&runs, k] { ++runs[k]; });
+    }
+    pool.wait();
+    for (size_t k = 0; k < runs.size(); ++k) {
+        EXPECT_EQ(runs[k], 1) << "Tâche " << k;
+    }
+
+    // Le groupe reste utilisable après un premier wait()
+    std::atomic<int> total(0);
+    for (int k = 0; k < 100; ++k) {
+        pool.submit([&total] { ++total; });
+    }
+    pool.wait();
+    EXPECT_EQ(total, 100);
+}
+
+// L'exception d'une tâche est relancée une seule fois par wait(), sans interrompre les autres
+TEST(WorkerPoolTests, TestTaskExceptionRethrown) {
+    WorkerPool pool(3);
+    std::atomic<int> done(0);
+    for (int k = 0; k < 20; ++k) {
+        pool.submit([&done, k] {
+            if (k == 7) throw std::runtime_error("Échec de la tâche.");
+            ++done;
+        });
+    }
+    EXPECT_THROW(pool.wait(), std::runtime_error);
+    EXPECT_EQ(done, 19);
+    EXPECT_NO_THROW(pool.wait());
+}
+
+// La mise à jour répartie sur plusieurs threads donne la même grille que la mise à jour séquentielle
+TEST(WorkerPoolTests, TestParallelUpdateMatchesSequential) {
+    for (bool toric : { false, true }) {
+        Grid sequential(203, 317);
+        fillRandom(sequential, 17);
+        sequential.setToric(toric);
+        Grid parallel(203, 317);
+        fillRandom(parallel, 17);
+        parallel.setToric(toric);
+        parallel.setThreads(4);
+
+        for (int k = 0; k < 40; ++k) {
+            sequential.update();
+            parallel.update();
+            ASSERT_EQ(parallel.hash(), sequential.hash()) << "Génération " << k + 1 << (toric ? " (torique)" : "");
+        }
+
+        // Une grille dupliquée calcule avec son propre groupe de threads
+        Grid copy = parallel.fork();
+        parallel.update();
+        copy.update();
+        sequential.update();
+        EXPECT_EQ(copy.hash(), sequential.hash());
+        EXPECT_EQ(parallel.hash(), sequential.hash());
+    }
+}